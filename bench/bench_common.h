@@ -0,0 +1,10 @@
+#pragma once
+
+// Wall-clock timing shared by the C++ benchmarks
+#include <chrono>
+
+using bench_clock = std::chrono::steady_clock;
+
+static inline double ms_since(bench_clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(bench_clock::now() - t0).count();
+}
@@ -0,0 +1,116 @@
+// Collider shape benchmark: legacy triangle-soup boxes/circles vs native Box2D shapes.
+// Reports contact count and average step time for a settling pile, plus the cost of
+// resizing colliders (destroy+recreate vs in-place fixture update).
+//
+// Usage: collider_shapes_bench [bodies=2000] [steps=600]
+#include "ame/physics.h"
+#include "bench_common.h"
+#include <box2d/box2d.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// Legacy path from SysCollider2DApply: box as 2 triangles, circle as 8 triangle fan
+static void add_legacy_box(b2Body* b, float w, float h) {
+    b2Vec2 p = b->GetPosition();
+    float hw = w * 0.5f, hh = h * 0.5f;
+    float v[12] = { p.x - hw, p.y - hh,  p.x + hw, p.y - hh,  p.x + hw, p.y + hh,
+                    p.x - hw, p.y - hh,  p.x + hw, p.y + hh,  p.x - hw, p.y + hh };
+    ame_physics_add_mesh_triangles_world(b, v, 2, false, 1.0f, 0.3f);
+}
+
+static void add_legacy_circle(b2Body* b, float r) {
+    b2Vec2 p = b->GetPosition();
+    enum { N = 8 };
+    float v[6 * N];
+    for (int k = 0; k < N; ++k) {
+        float a0 = (float)k * (6.28318530718f / N), a1 = (float)(k + 1) * (6.28318530718f / N);
+        v[k*6+0] = p.x; v[k*6+1] = p.y;
+        v[k*6+2] = p.x + r * cosf(a0); v[k*6+3] = p.y + r * sinf(a0);
+        v[k*6+4] = p.x + r * cosf(a1); v[k*6+5] = p.y + r * sinf(a1);
+    }
+    ame_physics_add_mesh_triangles_world(b, v, N, false, 1.0f, 0.3f);
+}
+
+struct PileResult { int fixtures; int contacts; int touching; double step_ms; double resize_ms; };
+
+static PileResult run_pile(bool native, int bodies, int steps) {
+    AmePhysicsWorld* pw = ame_physics_world_create(0.0f, -10.0f, 1.0f / 60.0f);
+    b2World* w = pw->world;
+
+    b2BodyDef gd; b2Body* ground = w->CreateBody(&gd);
+    b2EdgeShape floor; floor.SetTwoSided(b2Vec2(-200.0f, 0.0f), b2Vec2(200.0f, 0.0f));
+    ground->CreateFixture(&floor, 0.0f);
+
+    std::vector<b2Body*> list; list.reserve((size_t)bodies);
+    int cols = 64;
+    for (int i = 0; i < bodies; ++i) {
+        b2BodyDef bd; bd.type = b2_dynamicBody;
+        bd.position.Set(-64.0f + (float)(i % cols) * 2.0f + ((i / cols) & 1 ? 0.5f : 0.0f),
+                        1.0f + (float)(i / cols) * 2.0f);
+        b2Body* b = w->CreateBody(&bd);
+        bool circle = (i & 1) != 0;
+        if (native) {
+            if (circle) ame_physics_add_circle_fixture(b, 0.5f, false, 1.0f, 0.3f);
+            else        ame_physics_add_box_fixture(b, 1.0f, 1.0f, false, 1.0f, 0.3f);
+        } else {
+            if (circle) add_legacy_circle(b, 0.5f);
+            else        add_legacy_box(b, 1.0f, 1.0f);
+        }
+        list.push_back(b);
+    }
+
+    PileResult r = {};
+    r.fixtures = 0;
+    for (b2Body* b = w->GetBodyList(); b; b = b->GetNext())
+        for (b2Fixture* f = b->GetFixtureList(); f; f = f->GetNext()) r.fixtures++;
+
+    auto t0 = bench_clock::now();
+    for (int s = 0; s < steps; ++s) ame_physics_world_step(pw);
+    r.step_ms = ms_since(t0) / (double)steps;
+
+    r.contacts = w->GetContactCount();
+    for (b2Contact* c = w->GetContactList(); c; c = c->GetNext())
+        if (c->IsTouching()) r.touching++;
+
+    // Resize every collider once, the way a dirty Collider2D is applied
+    t0 = bench_clock::now();
+    for (size_t i = 0; i < list.size(); ++i) {
+        b2Body* b = list[i];
+        bool circle = (i & 1) != 0;
+        if (native) {
+            bool ok = circle ? ame_physics_update_circle_fixture(b, 0.45f, false)
+                             : ame_physics_update_box_fixture(b, 0.9f, 0.9f, false);
+            if (!ok) std::fprintf(stderr, "in-place update failed on body %zu\n", i);
+        } else {
+            ame_physics_destroy_all_fixtures(b);
+            if (circle) add_legacy_circle(b, 0.45f);
+            else        add_legacy_box(b, 0.9f, 0.9f);
+        }
+    }
+    ame_physics_world_step(pw);
+    r.resize_ms = ms_since(t0);
+
+    ame_physics_world_destroy(pw);
+    return r;
+}
+
+int main(int argc, char** argv) {
+    int bodies = argc > 1 ? std::atoi(argv[1]) : 2000;
+    int steps = argc > 2 ? std::atoi(argv[2]) : 600;
+    if (bodies <= 0) bodies = 2000;
+    if (steps <= 0) steps = 600;
+
+    PileResult legacy = run_pile(false, bodies, steps);
+    PileResult native = run_pile(true, bodies, steps);
+
+    std::printf("collider_shapes_bench: %d bodies (half boxes, half circles), %d steps\n", bodies, steps);
+    std::printf("%-8s %10s %10s %10s %12s %12s\n", "mode", "fixtures", "contacts", "touching", "step ms", "resize ms");
+    std::printf("%-8s %10d %10d %10d %12.3f %12.3f\n", "legacy", legacy.fixtures, legacy.contacts, legacy.touching, legacy.step_ms, legacy.resize_ms);
+    std::printf("%-8s %10d %10d %10d %12.3f %12.3f\n", "native", native.fixtures, native.contacts, native.touching, native.step_ms, native.resize_ms);
+    if (native.step_ms > 0.0)
+        std::printf("step speedup: %.2fx, contacts: %.2fx fewer\n", legacy.step_ms / native.step_ms,
+                    native.contacts > 0 ? (double)legacy.contacts / (double)native.contacts : 0.0);
+    return 0;
+}
@@ -0,0 +1,139 @@
+// Bytes per entity the render extraction loop drags through cache, before and after the hot/cold
+// split of the façade components. "inline" registers the previous layouts (SpriteData with its
+// dirty flag, TextData with the 256-byte request buffer); "split" uses the current ones. Both
+// run the sprite and text loops of the render extraction over cached queries, on separate
+// entity sets of one world (the façade component ids are per process).
+//
+// Usage: component_bytes_bench [entities=20000] [frames=300]
+#include "unitylike/Scene.h"
+#include "unitylike/TransformHierarchy.h"
+#include "ame/text_system.h"
+#include "bench_common.h"
+#include <flecs.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace unitylike;
+
+// Previous layouts
+struct InlineSprite { std::uint32_t tex; float u0,v0,u1,v1; float w,h; float r,g,b,a; int visible; int sorting_layer; int order_in_layer; float z; int dirty; };
+struct InlineText { const char* text_ptr; std::uint32_t font; float r,g,b,a; float size; int wrap_px; int request_set; char request_buf[256]; };
+
+static ecs_entity_t register_raw(ecs_world_t* w, const char* name, std::size_t size, std::size_t align) {
+    ecs_component_desc_t cdp = (ecs_component_desc_t){0};
+    ecs_entity_desc_t edp = {0}; edp.name = name;
+    cdp.entity = ecs_entity_init(w, &edp);
+    cdp.type.size = (int32_t)size;
+    cdp.type.alignment = (int32_t)align;
+    return ecs_component_init(w, &cdp);
+}
+
+struct Layout {
+    const char* name;
+    ecs_entity_t sprite, text;
+    std::size_t sprite_size, text_size;
+    bool arena_text; // Text strings must come from the text arena, which releases them
+};
+
+// The gather half of the render extraction: sprite rows with both transforms, text rows with
+// the local transform and the string
+template <typename S, typename T>
+static std::size_t extract(ecs_world_t* w, ecs_query_t* sprites, ecs_query_t* texts,
+                           std::vector<S>& out_sprites, std::vector<char>& out_chars) {
+    out_sprites.clear();
+    out_chars.clear();
+    float sink = 0.0f;
+    ecs_iter_t it = ecs_query_iter(w, sprites);
+    while (ecs_query_next(&it)) {
+        const S* s = ecs_field(&it, S, 0);
+        const AmeTransform2D* t = ecs_field(&it, AmeTransform2D, 1);
+        const AmeWorldTransform2D* wt = ecs_field(&it, AmeWorldTransform2D, 2);
+        for (int i = 0; i < it.count; ++i) {
+            if (!s[i].visible) continue;
+            out_sprites.push_back(s[i]);
+            sink += t[i].x + wt[i].x;
+        }
+    }
+    it = ecs_query_iter(w, texts);
+    while (ecs_query_next(&it)) {
+        const T* t = ecs_field(&it, T, 0);
+        const AmeTransform2D* tr = ecs_field(&it, AmeTransform2D, 1);
+        for (int i = 0; i < it.count; ++i) {
+            if (!t[i].text_ptr) continue;
+            out_chars.insert(out_chars.end(), t[i].text_ptr, t[i].text_ptr + std::strlen(t[i].text_ptr) + 1);
+            sink += tr[i].x + t[i].size;
+        }
+    }
+    return out_sprites.size() + (sink < 0.0f ? 1 : 0);
+}
+
+template <typename S, typename T>
+static void run(ecs_world_t* w, const Layout& l, int count, int frames) {
+    ecs_entity_t sprite = l.sprite, text = l.text;
+    static const char* kLabel = "hp 100";
+    for (int i = 0; i < count; ++i) {
+        ecs_entity_t e = ecs_new(w);
+        AmeTransform2D t = { (float)(i % 100), (float)(i / 100), 0.0f };
+        ecs_set_id(w, e, g_comp.transform, sizeof t, &t);
+        S s = {};
+        s.w = s.h = 16.0f; s.r = s.g = s.b = s.a = 1.0f; s.u1 = s.v1 = 1.0f;
+        s.visible = 1; s.sorting_layer = i % 4;
+        ecs_set_id(w, e, sprite, sizeof s, &s);
+        // One in eight sprites carries a label
+        if (i % 8 == 0) {
+            T td = {};
+            td.text_ptr = l.arena_text ? ame_text_store(w, kLabel, std::strlen(kLabel)) : kLabel;
+            td.r = td.g = td.b = td.a = 1.0f; td.size = 16.0f;
+            ecs_set_id(w, e, text, sizeof td, &td);
+        }
+    }
+
+    ecs_query_desc_t d = {};
+    d.cache_kind = EcsQueryCacheAuto;
+    d.terms[0].id = sprite;
+    d.terms[1].id = g_comp.transform;
+    d.terms[2].id = g_comp.world_transform;
+    ecs_query_t* sq = ecs_query_init(w, &d);
+    d = {};
+    d.cache_kind = EcsQueryCacheAuto;
+    d.terms[0].id = text;
+    d.terms[1].id = g_comp.transform;
+    ecs_query_t* tq = ecs_query_init(w, &d);
+
+    std::vector<S> out_sprites;
+    std::vector<char> out_chars;
+    std::size_t n = 0;
+    auto t0 = bench_clock::now();
+    for (int f = 0; f < frames; ++f) n = extract<S, T>(w, sq, tq, out_sprites, out_chars);
+    double ms = ms_since(t0) / (double)frames;
+
+    std::size_t sprite_bytes = l.sprite_size + sizeof(AmeTransform2D) + sizeof(AmeWorldTransform2D);
+    std::size_t text_bytes = l.text_size + sizeof(AmeTransform2D);
+    std::printf("%-8s %14zu %12zu %10zu %12.4f\n", l.name, sprite_bytes, text_bytes, n, ms);
+
+    ecs_query_fini(sq);
+    ecs_query_fini(tq);
+}
+
+int main(int argc, char** argv) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 20000;
+    int frames = argc > 2 ? std::atoi(argv[2]) : 300;
+    if (count <= 0) count = 20000;
+    if (frames <= 0) frames = 300;
+
+    std::printf("component_bytes_bench: %d sprites (1/8 with text), %d frames\n", count, frames);
+    std::printf("%-8s %14s %12s %10s %12s\n", "layout", "sprite B/ent", "text B/ent", "sprites", "frame ms");
+    ecs_world_t* w = ecs_init();
+    ensure_components_registered(w);
+    Layout inline_layout = { "inline",
+        register_raw(w, "InlineSprite", sizeof(InlineSprite), alignof(InlineSprite)),
+        register_raw(w, "InlineText", sizeof(InlineText), alignof(InlineText)),
+        sizeof(InlineSprite), sizeof(InlineText), false };
+    Layout split_layout = { "split", g_comp.sprite, g_comp.text, sizeof(SpriteData), sizeof(TextData), true };
+    run<InlineSprite, InlineText>(w, inline_layout, count, frames);
+    run<SpriteData, TextData>(w, split_layout, count, frames);
+    ecs_fini(w);
+    return 0;
+}
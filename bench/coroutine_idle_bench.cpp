@@ -0,0 +1,82 @@
+// Idle behaviour cost: `count` scripts that toggle a flag every two seconds. "polling" counts
+// the time down in Update every frame; "coroutine" sleeps in WaitForSeconds and is resumed by
+// the timer wheel only when due. Both run Scene::Step at 60 Hz; the frame time is what the
+// sleeping scripts cost.
+//
+// Usage: coroutine_idle_bench [scripts=10000] [frames=600]
+#include "unitylike/Scene.h"
+#include "unitylike/Coroutine.h"
+#include "bench_common.h"
+#include <flecs.h>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace unitylike;
+
+static long g_toggles = 0;
+
+struct PollingBlink : MongooseBehaviour {
+    float left = 0.0f;
+    bool on = false;
+    void Update(float dt) override {
+        left -= dt;
+        if (left > 0.0f) return;
+        left += 2.0f;
+        on = !on;
+        g_toggles++;
+    }
+};
+
+struct CoroutineBlink : MongooseBehaviour {
+    float phase = 0.0f;
+    bool on = false;
+    void Start() override { StartCoroutine(Blink()); }
+    Coroutine Blink() {
+        co_await WaitForSeconds(phase);
+        for (;;) {
+            on = !on;
+            g_toggles++;
+            co_await WaitForSeconds(2.0f);
+        }
+    }
+};
+
+template <typename T>
+static double run(ecs_world_t* w, int count, int frames, long* toggles) {
+    Scene scene(w);
+    for (int i = 0; i < count; ++i) {
+        GameObject go = scene.Create();
+        T& s = go.AddScript<T>();
+        // Spread the toggles over the period
+        float phase = 2.0f * (float)i / (float)count;
+        if constexpr (std::is_same_v<T, PollingBlink>) s.left = phase; else s.phase = phase;
+    }
+    scene.Step(1.0f / 60.0f); // Awake/Start
+    g_toggles = 0;
+    auto t0 = bench_clock::now();
+    for (int f = 0; f < frames; ++f) scene.Step(1.0f / 60.0f);
+    double ms = ms_since(t0) / (double)frames;
+    *toggles = g_toggles;
+    return ms;
+}
+
+int main(int argc, char** argv) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 10000;
+    int frames = argc > 2 ? std::atoi(argv[2]) : 600;
+    if (count <= 0) count = 10000;
+    if (frames <= 0) frames = 600;
+
+    ecs_world_t* w = ecs_init();
+    long toggles_poll = 0, toggles_co = 0;
+    double ms_poll = run<PollingBlink>(w, count, frames, &toggles_poll);
+    double ms_co = run<CoroutineBlink>(w, count, frames, &toggles_co);
+
+    std::printf("coroutine_idle_bench: %d scripts, %d frames\n", count, frames);
+    std::printf("%-10s %12s %10s\n", "mode", "frame ms", "toggles");
+    std::printf("%-10s %12.4f %10ld\n", "polling", ms_poll, toggles_poll);
+    std::printf("%-10s %12.4f %10ld\n", "coroutine", ms_co, toggles_co);
+    if (ms_co > 0.0) std::printf("speedup: %.2fx\n", ms_poll / ms_co);
+
+    ecs_fini(w);
+    return 0;
+}
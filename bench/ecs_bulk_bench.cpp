@@ -0,0 +1,74 @@
+// Bulk spawn benchmark: `count` entities with transform, velocity and lifetime components.
+// "one-by-one" is ame_ecs_entity_new + ame_ecs_set per component (a table move per set);
+// "bulk" is one ame_ecs_bulk_create straight into the final table.
+//
+// Usage: ecs_bulk_bench [count=10000] [rounds=20]
+#include "ame/ecs.h"
+#include "ame/physics.h"
+#include "bench_common.h"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+struct BenchVelocity { float vx, vy; };
+struct BenchLifetime { float seconds; };
+
+struct Ids { AmeEcsId transform, velocity, lifetime; };
+
+static Ids register_components(AmeEcsWorld* w) {
+    Ids ids;
+    ids.transform = ame_physics_register_transform_component(w);
+    ids.velocity = ame_ecs_component_register(w, "BenchVelocity", sizeof(BenchVelocity), alignof(BenchVelocity));
+    ids.lifetime = ame_ecs_component_register(w, "BenchLifetime", sizeof(BenchLifetime), alignof(BenchLifetime));
+    return ids;
+}
+
+int main(int argc, char** argv) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 10000;
+    int rounds = argc > 2 ? std::atoi(argv[2]) : 20;
+    if (count <= 0) count = 10000;
+    if (rounds <= 0) rounds = 20;
+
+    std::vector<AmeTransform2D> tr((size_t)count);
+    std::vector<BenchVelocity> vel((size_t)count);
+    std::vector<BenchLifetime> life((size_t)count);
+    for (int i = 0; i < count; ++i) {
+        tr[(size_t)i] = AmeTransform2D{ (float)(i % 128), (float)(i / 128), 0.0f };
+        vel[(size_t)i] = BenchVelocity{ 300.0f, (float)(i % 9) - 4.0f };
+        life[(size_t)i] = BenchLifetime{ 2.0f };
+    }
+    std::vector<AmeEcsId> out((size_t)count);
+
+    double single_ms = 0.0, bulk_ms = 0.0;
+    for (int r = 0; r < rounds; ++r) {
+        AmeEcsWorld* w = ame_ecs_world_create();
+        Ids ids = register_components(w);
+        auto t0 = bench_clock::now();
+        for (int i = 0; i < count; ++i) {
+            AmeEcsId e = ame_ecs_entity_new(w);
+            ame_ecs_set(w, e, ids.transform, &tr[(size_t)i], sizeof(AmeTransform2D));
+            ame_ecs_set(w, e, ids.velocity, &vel[(size_t)i], sizeof(BenchVelocity));
+            ame_ecs_set(w, e, ids.lifetime, &life[(size_t)i], sizeof(BenchLifetime));
+        }
+        single_ms += ms_since(t0);
+        ame_ecs_world_destroy(w);
+
+        w = ame_ecs_world_create();
+        ids = register_components(w);
+        const AmeEcsId comps[] = { ids.transform, ids.velocity, ids.lifetime };
+        const void* data[] = { tr.data(), vel.data(), life.data() };
+        t0 = bench_clock::now();
+        ame_ecs_bulk_create(w, (size_t)count, comps, data, 3, out.data());
+        bulk_ms += ms_since(t0);
+        ame_ecs_world_destroy(w);
+    }
+    single_ms /= (double)rounds;
+    bulk_ms /= (double)rounds;
+
+    std::printf("ecs_bulk_bench: %d entities x 3 components, %d rounds\n", count, rounds);
+    std::printf("%-12s %12s\n", "mode", "spawn ms");
+    std::printf("%-12s %12.3f\n", "one-by-one", single_ms);
+    std::printf("%-12s %12.3f\n", "bulk", bulk_ms);
+    if (bulk_ms > 0.0) std::printf("speedup: %.2fx\n", single_ms / bulk_ms);
+    return 0;
+}
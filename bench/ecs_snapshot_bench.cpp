@@ -0,0 +1,112 @@
+// Binary snapshot benchmark: save and load a scene of `count` entities (transform on all, sprite-like
+// payload on half, every 16th parented to one of 64 named groups) and compare the load with
+// ecs_world_to_json/ecs_world_from_json on the same world.
+//
+// Usage: ecs_snapshot_bench [count=100000]
+#include "ame/ecs_snapshot.h"
+#include "ame/physics.h"
+#include "bench_common.h"
+#include <flecs.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+struct BenchSprite { std::uint32_t tex; float u0, v0, u1, v1, w, h; int layer; };
+
+struct Ids { ecs_entity_t transform, sprite; };
+
+static ecs_entity_t component(ecs_world_t* w, const char* name, std::size_t size, std::size_t align) {
+    ecs_entity_desc_t ed = {};
+    ed.name = name;
+    ecs_component_desc_t cd = {};
+    cd.entity = ecs_entity_init(w, &ed);
+    cd.type.size = (ecs_size_t)size;
+    cd.type.alignment = (ecs_size_t)align;
+    return ecs_component_init(w, &cd);
+}
+
+static Ids register_components(ecs_world_t* w) {
+    Ids ids;
+    ids.transform = component(w, "AmeTransform2D", sizeof(AmeTransform2D), alignof(AmeTransform2D));
+    ids.sprite = component(w, "BenchSprite", sizeof(BenchSprite), alignof(BenchSprite));
+    return ids;
+}
+
+static AmeSnapshotSchema* make_schema(ecs_world_t* w, const Ids& ids) {
+    AmeSnapshotSchema* s = ame_snapshot_schema_create();
+    ame_snapshot_schema_add(s, w, ids.transform, nullptr);
+    ame_snapshot_schema_add(s, w, ids.sprite, nullptr);
+    return s;
+}
+
+int main(int argc, char** argv) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 100000;
+    if (count <= 0) count = 100000;
+    const char* path = "ecs_snapshot_bench.bin";
+
+    ecs_world_t* src = ecs_init();
+    Ids ids = register_components(src);
+    ecs_entity_t groups[64];
+    for (int g = 0; g < 64; ++g) {
+        char name[32];
+        std::snprintf(name, sizeof name, "group%d", g);
+        ecs_entity_desc_t ed = {};
+        ed.name = name;
+        groups[g] = ecs_entity_init(src, &ed);
+        AmeTransform2D t = { 0.0f, 0.0f, 0.0f };
+        ecs_set_id(src, groups[g], ids.transform, sizeof t, &t);
+    }
+    for (int i = 0; i < count; ++i) {
+        ecs_entity_t e = ecs_new(src);
+        AmeTransform2D t = { (float)(i % 512), (float)(i / 512), 0.0f };
+        ecs_set_id(src, e, ids.transform, sizeof t, &t);
+        if (i % 2 == 0) {
+            BenchSprite s = { 1u, 0.0f, 0.0f, 1.0f, 1.0f, 16.0f, 16.0f, i % 4 };
+            ecs_set_id(src, e, ids.sprite, sizeof s, &s);
+        }
+        if (i % 16 == 0) ecs_add_pair(src, e, EcsChildOf, groups[i % 64]);
+    }
+
+    AmeSnapshotSchema* schema = make_schema(src, ids);
+    auto t0 = bench_clock::now();
+    bool saved = ame_snapshot_save(src, schema, path);
+    double save_ms = ms_since(t0);
+    ame_snapshot_schema_destroy(schema);
+    if (!saved) { std::fprintf(stderr, "save failed\n"); return 1; }
+
+    FILE* f = std::fopen(path, "rb");
+    long file_bytes = 0;
+    if (f) { std::fseek(f, 0, SEEK_END); file_bytes = std::ftell(f); std::fclose(f); }
+
+    ecs_world_t* dst = ecs_init();
+    Ids dst_ids = register_components(dst);
+    schema = make_schema(dst, dst_ids);
+    std::size_t loaded = 0;
+    t0 = bench_clock::now();
+    AmeSnapshotFile* file = ame_snapshot_load(dst, schema, path, &loaded);
+    double load_ms = ms_since(t0);
+    ame_snapshot_schema_destroy(schema);
+
+    // JSON needs meta for the component values; without it only ids/names/hierarchy round trip,
+    // which still bounds the parse cost from below
+    char* json = ecs_world_to_json(src, nullptr);
+    std::size_t json_bytes = json ? std::strlen(json) : 0;
+    ecs_world_t* jdst = ecs_init();
+    register_components(jdst);
+    t0 = bench_clock::now();
+    if (json) ecs_world_from_json(jdst, json, nullptr);
+    double json_ms = ms_since(t0);
+
+    std::printf("ecs_snapshot_bench: %d entities (%zu loaded)\n", count, loaded);
+    std::printf("%-10s %12s %12s %14s\n", "format", "save ms", "load ms", "bytes");
+    std::printf("%-10s %12.2f %12.2f %14ld\n", "snapshot", save_ms, load_ms, file_bytes);
+    std::printf("%-10s %12s %12.2f %14zu\n", "json", "-", json_ms, json_bytes);
+
+    if (json) ecs_os_free(json);
+    ecs_fini(jdst);
+    ecs_fini(dst);
+    ame_snapshot_file_close(file);
+    ecs_fini(src);
+    std::remove(path);
+    return 0;
+}
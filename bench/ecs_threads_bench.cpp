@@ -0,0 +1,108 @@
+// ECS worker-thread scaling benchmark: a 50k-entity scene progressed with 1/2/4/8 Flecs worker
+// threads. Every entity runs a multi_threaded movement system; one in five also carries a Box2D
+// body whose pose SysPhysicsWriteback copies back after the (main-thread) physics step.
+// Only ecs_progress is timed; the physics step is reported separately.
+//
+// Usage: ecs_threads_bench [entities=50000] [frames=200]
+#include "ame/ecs.h"
+#include "ame/physics.h"
+#include "ame/collider2d_system.h"
+#include "bench_common.h"
+#include <flecs.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+struct BenchVelocity { float vx, vy, phase; };
+
+// Stand-in for per-entity gameplay logic: a little trig per row
+static void SysBenchMove(ecs_iter_t* it) {
+    BenchVelocity* v = ecs_field(it, BenchVelocity, 0);
+    AmeTransform2D* t = ecs_field(it, AmeTransform2D, 1);
+    for (int i = 0; i < it->count; ++i) {
+        v[i].phase += it->delta_time;
+        t[i].x += v[i].vx * it->delta_time + 0.01f * std::sin(v[i].phase);
+        t[i].y += v[i].vy * it->delta_time + 0.01f * std::cos(v[i].phase);
+        t[i].angle = std::atan2(v[i].vy, v[i].vx);
+    }
+}
+
+struct RunResult { double progress_ms, step_ms; };
+
+static RunResult run(int entities, int frames, int threads) {
+    AmeEcsWorld* ew = ame_ecs_world_create();
+    ecs_world_t* w = (ecs_world_t*)ame_ecs_world_ptr(ew);
+    AmePhysicsWorld* physics = ame_physics_world_create(0.0f, 0.0f, 1.0f / 60.0f);
+
+    ecs_entity_t BodyId = (ecs_entity_t)ame_physics_register_body_component(ew);
+    ecs_entity_t TransformId = (ecs_entity_t)ame_physics_register_transform_component(ew);
+    ecs_entity_t VelId = (ecs_entity_t)ame_ecs_component_register(ew, "BenchVelocity", sizeof(BenchVelocity), alignof(BenchVelocity));
+    ame_physics_writeback_system_register(w, physics);
+
+    ecs_system_desc_t sd = {};
+    ecs_entity_desc_t ed = {};
+    ecs_id_t phase[] = { ecs_pair(EcsDependsOn, EcsOnUpdate), 0 };
+    ed.name = "SysBenchMove"; ed.add = phase;
+    sd.entity = ecs_entity_init(w, &ed);
+    sd.callback = SysBenchMove;
+    sd.query.terms[0].id = VelId;
+    sd.query.terms[1].id = TransformId;
+    sd.query.terms[2].id = BodyId; sd.query.terms[2].oper = EcsNot;
+    sd.multi_threaded = true;
+    ecs_system_init(w, &sd);
+
+    for (int i = 0; i < entities; ++i) {
+        ecs_entity_t e = ecs_new(w);
+        float x = (float)(i % 250) * 3.0f, y = (float)(i / 250) * 3.0f;
+        AmeTransform2D t = { x, y, 0.0f };
+        ecs_set_id(w, e, TransformId, sizeof t, &t);
+        if (i % 5 == 0) {
+            AmePhysicsBody pb = {};
+            pb.body = ame_physics_create_body(physics, x, y, 1.0f, 1.0f, AME_BODY_DYNAMIC, false, NULL);
+            pb.width = pb.height = 1.0f;
+            pb.handle = ame_physics_body_handle(physics, pb.body);
+            ame_physics_body_set_entity(physics, pb.handle, e);
+            ame_physics_set_velocity(pb.body, (float)(i % 7) - 3.0f, (float)(i % 5) - 2.0f);
+            ecs_set_id(w, e, BodyId, sizeof pb, &pb);
+        } else {
+            BenchVelocity v = { (float)(i % 7) - 3.0f, (float)(i % 5) - 2.0f, (float)i };
+            ecs_set_id(w, e, VelId, sizeof v, &v);
+        }
+    }
+
+    ame_ecs_world_set_threads(ew, threads);
+    RunResult r = { 0.0, 0.0 };
+    for (int f = 0; f < frames; ++f) {
+        auto t0 = bench_clock::now();
+        ame_physics_world_step(physics);
+        r.step_ms += ms_since(t0);
+        t0 = bench_clock::now();
+        ame_ecs_world_progress(ew, 1.0 / 60.0);
+        r.progress_ms += ms_since(t0);
+    }
+    r.progress_ms /= (double)frames;
+    r.step_ms /= (double)frames;
+
+    ame_ecs_world_destroy(ew);
+    ame_physics_world_destroy(physics);
+    return r;
+}
+
+int main(int argc, char** argv) {
+    int entities = argc > 1 ? std::atoi(argv[1]) : 50000;
+    int frames = argc > 2 ? std::atoi(argv[2]) : 200;
+    if (entities <= 0) entities = 50000;
+    if (frames <= 0) frames = 200;
+
+    std::printf("ecs_threads_bench: %d entities, %d frames\n", entities, frames);
+    std::printf("%-8s %14s %10s %14s\n", "threads", "progress ms", "speedup", "phys step ms");
+    double base = 0.0;
+    const int counts[] = { 1, 2, 4, 8 };
+    for (int threads : counts) {
+        RunResult r = run(entities, frames, threads);
+        if (threads == 1) base = r.progress_ms;
+        std::printf("%-8d %14.3f %10.2f %14.3f\n", threads, r.progress_ms,
+                    r.progress_ms > 0.0 ? base / r.progress_ms : 0.0, r.step_ms);
+    }
+    return 0;
+}
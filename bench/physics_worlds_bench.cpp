@@ -0,0 +1,88 @@
+// Parallel world stepping benchmark: several independent worlds of uneven size (rooms, minigames,
+// AI sandboxes) stepped one after another vs ame_physics_worlds_step_parallel_pool with 1..N workers.
+// The ideal parallel time is the cost of the largest world.
+//
+// Usage: physics_worlds_bench [worlds=8] [bodies_largest=1500] [steps=300]
+#include "ame/physics.h"
+#include "ame/jobs.h"
+#include "bench_common.h"
+#include <box2d/box2d.h>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+// A settling pile of boxes on a floor; keeps contacts busy for the whole run
+static AmePhysicsWorld* make_room(int bodies) {
+    AmePhysicsWorld* pw = ame_physics_world_create(0.0f, -10.0f, 1.0f / 60.0f);
+    b2BodyDef gd; b2Body* ground = pw->world->CreateBody(&gd);
+    b2EdgeShape floor; floor.SetTwoSided(b2Vec2(-100.0f, 0.0f), b2Vec2(100.0f, 0.0f));
+    ground->CreateFixture(&floor, 0.0f);
+    int cols = 40;
+    for (int i = 0; i < bodies; ++i) {
+        b2BodyDef bd; bd.type = b2_dynamicBody;
+        bd.position.Set(-40.0f + (float)(i % cols) * 2.0f + ((i / cols) & 1 ? 0.5f : 0.0f),
+                        1.0f + (float)(i / cols) * 2.0f);
+        b2Body* b = pw->world->CreateBody(&bd);
+        ame_physics_add_box_fixture(b, 1.0f, 1.0f, false, 1.0f, 0.3f);
+    }
+    return pw;
+}
+
+static std::vector<AmePhysicsWorld*> make_rooms(int count, int largest) {
+    std::vector<AmePhysicsWorld*> rooms;
+    for (int i = 0; i < count; ++i) rooms.push_back(make_room(largest / (1 + i % 4)));
+    return rooms;
+}
+
+static void free_rooms(std::vector<AmePhysicsWorld*>& rooms) {
+    for (AmePhysicsWorld* w : rooms) ame_physics_world_destroy(w);
+    rooms.clear();
+}
+
+int main(int argc, char** argv) {
+    int worlds = argc > 1 ? std::atoi(argv[1]) : 8;
+    int largest = argc > 2 ? std::atoi(argv[2]) : 1500;
+    int steps = argc > 3 ? std::atoi(argv[3]) : 300;
+    if (worlds <= 0) worlds = 8;
+    if (largest <= 0) largest = 1500;
+    if (steps <= 0) steps = 300;
+
+    // Sequential baseline, with the largest world timed on its own
+    std::vector<AmePhysicsWorld*> rooms = make_rooms(worlds, largest);
+    double largest_ms = 0.0;
+    auto t0 = bench_clock::now();
+    for (int s = 0; s < steps; ++s) {
+        for (AmePhysicsWorld* w : rooms) {
+            auto tw = bench_clock::now();
+            ame_physics_world_step(w);
+            if (w == rooms[0]) largest_ms += ms_since(tw);
+        }
+    }
+    double seq_ms = ms_since(t0) / (double)steps;
+    largest_ms /= (double)steps;
+    free_rooms(rooms);
+
+    std::printf("physics_worlds_bench: %d worlds (largest %d bodies), %d steps\n", worlds, largest, steps);
+    std::printf("%-12s %12s %10s %14s\n", "mode", "frame ms", "speedup", "vs largest");
+    std::printf("%-12s %12.3f %10.2f %14.2f\n", "sequential", seq_ms, 1.0, seq_ms / largest_ms);
+
+    unsigned hw = std::thread::hardware_concurrency();
+    int max_workers = hw > 1 ? (int)hw - 1 : 1;
+    for (int workers = 1; ; workers *= 2) {
+        if (workers > max_workers) workers = max_workers;
+        AmeJobPool* pool = ame_jobs_create(workers);
+        rooms = make_rooms(worlds, largest);
+        t0 = bench_clock::now();
+        for (int s = 0; s < steps; ++s) ame_physics_worlds_step_parallel_pool(pool, rooms.data(), rooms.size());
+        double par_ms = ms_since(t0) / (double)steps;
+        free_rooms(rooms);
+        ame_jobs_destroy(pool);
+
+        char label[32];
+        std::snprintf(label, sizeof label, "%d+1 threads", workers);
+        std::printf("%-12s %12.3f %10.2f %14.2f\n", label, par_ms, seq_ms / par_ms, par_ms / largest_ms);
+        if (workers == max_workers) break;
+    }
+    return 0;
+}
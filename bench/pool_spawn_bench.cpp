@@ -0,0 +1,91 @@
+// Short-lived spawns: every frame `spawns` bullets (Transform, SpriteRenderer, Material and a
+// Bullet script) are created and the ones older than `life` frames go away. "create" builds each
+// bullet with Scene::Create + AddComponent/AddScript and removes it with Scene::Destroy; "pool"
+// takes it from a GameObjectPool (script added once per copy by the pool's init callback) and
+// gives it back with Release. Both run Scene::Step at 60 Hz.
+//
+// Usage: pool_spawn_bench [spawns=500] [life=30] [frames=600]
+#include "unitylike/Scene.h"
+#include "bench_common.h"
+#include <flecs.h>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+
+using namespace unitylike;
+
+struct Bullet : MongooseBehaviour {
+    float age = 0.0f;
+    void Update(float dt) override { age += dt; }
+};
+
+static void setup_bullet(GameObject& go) {
+    go.AddComponent<Transform>();
+    SpriteRenderer& sr = go.AddComponent<SpriteRenderer>();
+    sr.size(glm::vec2(4.0f, 4.0f));
+    sr.texture(1);
+    go.AddComponent<Material>();
+}
+
+static double run_create(ecs_world_t* w, int spawns, int life, int frames) {
+    Scene scene(w);
+    std::deque<GameObject> live;
+    auto t0 = bench_clock::now();
+    for (int f = 0; f < frames; ++f) {
+        for (int i = 0; i < spawns; ++i) {
+            GameObject go = scene.Create();
+            setup_bullet(go);
+            go.AddScript<Bullet>();
+            go.transform().position(glm::vec3((float)i, (float)f, 0.0f));
+            live.push_back(go);
+        }
+        while ((int)live.size() > spawns * life) {
+            scene.Destroy(live.front());
+            live.pop_front();
+        }
+        scene.Step(1.0f / 60.0f);
+    }
+    return ms_since(t0) / (double)frames;
+}
+
+static double run_pool(ecs_world_t* w, int spawns, int life, int frames) {
+    Scene scene(w);
+    GameObject prefab = scene.Create("BulletPrefab");
+    setup_bullet(prefab);
+    prefab.SetActive(false);
+    GameObjectPool& pool = scene.CreatePool(prefab, (std::size_t)(spawns * (life + 1)), nullptr,
+                                            [](GameObject& go) { go.AddScript<Bullet>(); });
+    std::deque<GameObject> live;
+    auto t0 = bench_clock::now();
+    for (int f = 0; f < frames; ++f) {
+        for (int i = 0; i < spawns; ++i) live.push_back(pool.Acquire(glm::vec2((float)i, (float)f)));
+        while ((int)live.size() > spawns * life) {
+            pool.Release(live.front());
+            live.pop_front();
+        }
+        scene.Step(1.0f / 60.0f);
+    }
+    return ms_since(t0) / (double)frames;
+}
+
+int main(int argc, char** argv) {
+    int spawns = argc > 1 ? std::atoi(argv[1]) : 500;
+    int life = argc > 2 ? std::atoi(argv[2]) : 30;
+    int frames = argc > 3 ? std::atoi(argv[3]) : 600;
+    if (spawns <= 0) spawns = 500;
+    if (life <= 0) life = 30;
+    if (frames <= 0) frames = 600;
+
+    ecs_world_t* w = ecs_init();
+    double ms_create = run_create(w, spawns, life, frames);
+    double ms_pool = run_pool(w, spawns, life, frames);
+
+    std::printf("pool_spawn_bench: %d spawns/frame, %d frames alive, %d frames\n", spawns, life, frames);
+    std::printf("%-8s %12s\n", "mode", "frame ms");
+    std::printf("%-8s %12.4f\n", "create", ms_create);
+    std::printf("%-8s %12.4f\n", "pool", ms_pool);
+    if (ms_pool > 0.0) std::printf("speedup: %.2fx\n", ms_create / ms_pool);
+
+    ecs_fini(w);
+    return 0;
+}
@@ -0,0 +1,115 @@
+// Homogeneous crowds: `count` coins with the same Sprite, Material and Collider2D. "copied"
+// spawns them with Scene::CreateBulk carrying every component per entity; "prefab" spawns IsA
+// instances of a Scene::CreatePrefab object that only own their Transform. Reports the spawn
+// time, the component bytes stored per entity and one pass of a Sprite + Transform query
+// reading the sprite the way the render extraction does (ecs_field_is_self).
+//
+// Usage: prefab_spawn_bench [count=100000] [rounds=10]
+#include "unitylike/Scene.h"
+#include "bench_common.h"
+#include <flecs.h>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace unitylike;
+
+struct Result { double spawn_ms; double bytes; double query_ms; };
+
+// Bytes of the components an entity stores in its own table row
+static double owned_bytes(ecs_world_t* w, ecs_entity_t e) {
+    const ecs_type_t* type = ecs_get_type(w, e);
+    std::size_t bytes = 0;
+    for (int32_t i = 0; type && i < type->count; ++i) {
+        const ecs_type_info_t* ti = ecs_get_type_info(w, type->array[i]);
+        if (ti) bytes += (std::size_t)ti->size;
+    }
+    return (double)bytes;
+}
+
+static double query_pass(ecs_world_t* w, ecs_query_t* q) {
+    auto t0 = bench_clock::now();
+    double sum = 0.0;
+    ecs_iter_t it = ecs_query_iter(w, q);
+    while (ecs_query_next(&it)) {
+        const SpriteData* sp = (const SpriteData*)ecs_field_w_size(&it, sizeof(SpriteData), 0);
+        const AmeTransform2D* tr = (const AmeTransform2D*)ecs_field_w_size(&it, sizeof(AmeTransform2D), 1);
+        bool sp_self = ecs_field_is_self(&it, 0);
+        for (int i = 0; i < it.count; ++i) sum += sp[sp_self ? i : 0].w + tr[i].x;
+    }
+    double ms = ms_since(t0);
+    if (sum < 0.0) std::printf("%f\n", sum); // keep the loop
+    return ms;
+}
+
+static Result run(ecs_world_t* w, int count, int rounds, bool prefab) {
+    Scene scene(w);
+    SpriteData sprite{ 1u, 0.0f, 0.0f, 1.0f, 1.0f, 8.0f, 8.0f, 1.0f, 1.0f, 0.0f, 1.0f, 1, 0, 0, 1.0f };
+    MaterialData material{ 1u, 1.0f, 1.0f, 1.0f, 1.0f };
+    Col2D collider{ 1, 0.0f, 0.0f, 4.0f, 1, 1 };
+    std::vector<AmeTransform2D> transforms((std::size_t)count);
+    for (int i = 0; i < count; ++i) transforms[(std::size_t)i] = AmeTransform2D{ (float)(i % 1000), (float)(i / 1000), 0.0f };
+
+    BulkSpawn spawn;
+    spawn.transforms = transforms.data();
+    std::vector<SpriteData> sprites;
+    std::vector<MaterialData> materials;
+    std::vector<Col2D> colliders;
+    if (prefab) {
+        GameObject coin = scene.CreatePrefab();
+        ecs_entity_t c = (ecs_entity_t)coin.id();
+        ecs_set_id(w, c, g_comp.sprite, sizeof sprite, &sprite);
+        ecs_set_id(w, c, g_comp.material, sizeof material, &material);
+        ecs_set_id(w, c, g_comp.collider2d, sizeof collider, &collider);
+        spawn.prefab = coin.id();
+    } else {
+        sprites.assign((std::size_t)count, sprite);
+        materials.assign((std::size_t)count, material);
+        colliders.assign((std::size_t)count, collider);
+        spawn.sprites = sprites.data();
+        spawn.materials = materials.data();
+        spawn.colliders = colliders.data();
+    }
+
+    Result r{ 0.0, 0.0, 0.0 };
+    for (int round = 0; round < rounds; ++round) {
+        auto t0 = bench_clock::now();
+        std::vector<GameObject> objs = scene.CreateBulk((std::size_t)count, spawn);
+        r.spawn_ms += ms_since(t0);
+        if (round == 0) {
+            r.bytes = owned_bytes(w, (ecs_entity_t)objs[0].id());
+            ecs_query_desc_t d = {};
+            d.cache_kind = EcsQueryCacheAuto;
+            d.terms[0].id = g_comp.sprite;
+            d.terms[1].id = g_comp.transform;
+            ecs_query_t* q = ecs_query_init(w, &d);
+            query_pass(w, q); // warm
+            for (int k = 0; k < 10; ++k) r.query_ms += query_pass(w, q) / 10.0;
+            ecs_query_fini(q);
+        }
+        for (GameObject& go : objs) ecs_delete(w, (ecs_entity_t)go.id());
+    }
+    r.spawn_ms /= (double)rounds;
+    return r;
+}
+
+int main(int argc, char** argv) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 100000;
+    int rounds = argc > 2 ? std::atoi(argv[2]) : 10;
+    if (count <= 0) count = 100000;
+    if (rounds <= 0) rounds = 10;
+
+    ecs_world_t* w = ecs_init();
+    ensure_components_registered(w);
+    Result copied = run(w, count, rounds, false);
+    Result shared = run(w, count, rounds, true);
+
+    std::printf("prefab_spawn_bench: %d entities, %d rounds\n", count, rounds);
+    std::printf("%-8s %12s %12s %12s\n", "mode", "spawn ms", "bytes/ent", "query ms");
+    std::printf("%-8s %12.3f %12.0f %12.3f\n", "copied", copied.spawn_ms, copied.bytes, copied.query_ms);
+    std::printf("%-8s %12.3f %12.0f %12.3f\n", "prefab", shared.spawn_ms, shared.bytes, shared.query_ms);
+    if (shared.spawn_ms > 0.0) std::printf("spawn speedup: %.2fx\n", copied.spawn_ms / shared.spawn_ms);
+
+    ecs_fini(w);
+    return 0;
+}
@@ -0,0 +1,99 @@
+// Render pipeline gather benchmark: the CPU half of ame_rp_run_ecs for sprites, without GL.
+// "per-frame" builds the sprite query every frame and fetches components with ecs_get_id per
+// entity (the previous renderer); "cached" reuses one cached query and reads the ecs_field columns.
+//
+// Usage: render_queries_bench [sprites=10000] [frames=300]
+#include "unitylike/Scene.h"
+#include "bench_common.h"
+#include <flecs.h>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace unitylike;
+
+struct Gathered { AmeTransform2D transform; SpriteData sprite; ecs_entity_t entity; };
+
+static size_t gather_per_frame(ecs_world_t* w, std::vector<Gathered>& out) {
+    out.clear();
+    ecs_query_desc_t d = {};
+    d.terms[0].id = g_comp.sprite;
+    d.terms[1].id = g_comp.transform;
+    ecs_query_t* q = ecs_query_init(w, &d);
+    ecs_iter_t it = ecs_query_iter(w, q);
+    while (ecs_query_next(&it)) {
+        for (int i = 0; i < it.count; ++i) {
+            const SpriteData* s = (const SpriteData*)ecs_get_id(w, it.entities[i], g_comp.sprite);
+            const AmeTransform2D* t = (const AmeTransform2D*)ecs_get_id(w, it.entities[i], g_comp.transform);
+            if (s && t && s->visible) out.push_back({*t, *s, it.entities[i]});
+        }
+    }
+    ecs_query_fini(q);
+    return out.size();
+}
+
+static size_t gather_cached(ecs_world_t* w, ecs_query_t* q, std::vector<Gathered>& out) {
+    out.clear();
+    ecs_iter_t it = ecs_query_iter(w, q);
+    while (ecs_query_next(&it)) {
+        const SpriteData* s = ecs_field(&it, SpriteData, 0);
+        const AmeTransform2D* t = ecs_field(&it, AmeTransform2D, 1);
+        for (int i = 0; i < it.count; ++i) {
+            if (s[i].visible) out.push_back({t[i], s[i], it.entities[i]});
+        }
+    }
+    return out.size();
+}
+
+int main(int argc, char** argv) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 10000;
+    int frames = argc > 2 ? std::atoi(argv[2]) : 300;
+    if (count <= 0) count = 10000;
+    if (frames <= 0) frames = 300;
+
+    ecs_world_t* w = ecs_init();
+    ensure_components_registered(w);
+    for (int i = 0; i < count; ++i) {
+        ecs_entity_t e = ecs_new(w);
+        AmeTransform2D t = { (float)(i % 100), (float)(i / 100), 0.0f };
+        SpriteData s = {};
+        s.w = s.h = 16.0f; s.r = s.g = s.b = s.a = 1.0f; s.u1 = s.v1 = 1.0f;
+        s.visible = 1; s.sorting_layer = i % 4;
+        ecs_set_id(w, e, g_comp.transform, sizeof t, &t);
+        ecs_set_id(w, e, g_comp.sprite, sizeof s, &s);
+        // Some entities also carry a material, spreading sprites over two tables like a real scene
+        if (i % 3 == 0) {
+            MaterialData m = {};
+            m.r = m.g = m.b = m.a = 1.0f;
+            ecs_set_id(w, e, g_comp.material, sizeof m, &m);
+        }
+    }
+
+    std::vector<Gathered> out;
+    out.reserve((size_t)count);
+
+    size_t n_old = 0;
+    auto t0 = bench_clock::now();
+    for (int f = 0; f < frames; ++f) n_old = gather_per_frame(w, out);
+    double old_ms = ms_since(t0) / (double)frames;
+
+    ecs_query_desc_t d = {};
+    d.cache_kind = EcsQueryCacheAuto;
+    d.terms[0].id = g_comp.sprite;
+    d.terms[1].id = g_comp.transform;
+    ecs_query_t* q = ecs_query_init(w, &d);
+    size_t n_new = 0;
+    t0 = bench_clock::now();
+    for (int f = 0; f < frames; ++f) n_new = gather_cached(w, q, out);
+    double new_ms = ms_since(t0) / (double)frames;
+
+    std::printf("render_queries_bench: %d sprites, %d frames\n", count, frames);
+    std::printf("%-10s %10s %12s\n", "mode", "gathered", "frame ms");
+    std::printf("%-10s %10zu %12.4f\n", "per-frame", n_old, old_ms);
+    std::printf("%-10s %10zu %12.4f\n", "cached", n_new, new_ms);
+    if (new_ms > 0.0) std::printf("speedup: %.2fx\n", old_ms / new_ms);
+
+    ecs_query_fini(q);
+    ecs_fini(w);
+    return 0;
+}
@@ -0,0 +1,116 @@
+// MongooseBehaviour dispatch benchmark: Scene::Step over `count` scripts of four types (two
+// override Update, one Update + LateUpdate, one only Start). "per-entity" replays the previous
+// loop (host lookup per entity, every callback called virtually); "batched" is Scene::Step with
+// its per-type batches. The FixedUpdate rows run the same integrator serially and as a job-safe
+// type (kJobSafe) on the shared worker pool; each writes its own Transform.
+//
+// Usage: script_dispatch_bench [scripts=10000] [frames=300]
+#include "unitylike/Scene.h"
+#include "bench_common.h"
+#include <flecs.h>
+#include <cstdio>
+#include <cstdlib>
+#include <unordered_map>
+#include <vector>
+
+using namespace unitylike;
+
+static float g_sink = 0.0f;
+
+struct Spinner : MongooseBehaviour {
+    float angle = 0.0f;
+    void Update(float dt) override { angle += dt * 90.0f; }
+};
+struct Mover : MongooseBehaviour {
+    float x = 0.0f, v = 1.0f;
+    void Update(float dt) override { x += v * dt; }
+};
+struct Follower : MongooseBehaviour {
+    float target = 0.0f, at = 0.0f;
+    void Update(float dt) override { target += dt; }
+    void LateUpdate() override { at += (target - at) * 0.5f; g_sink += at; }
+};
+struct Marker : MongooseBehaviour {
+    int started = 0;
+    void Start() override { started = 1; }
+};
+struct Integrator : MongooseBehaviour {
+    float x = 0.0f, v = 1.0f;
+    void Start() override { gameObject().transform().position({0.0f, 0.0f, 0.0f}); }
+    void FixedUpdate(float fdt) override {
+        float h = fdt / 64.0f;
+        for (int i = 0; i < 64; ++i) { v -= x * h; x += v * h; }
+        gameObject().transform().position({x, 0.0f, 0.0f});
+    }
+};
+struct JobIntegrator : Integrator {
+    static constexpr bool kJobSafe = true;
+};
+
+template <typename T>
+static double run_fixed(ecs_world_t* w, int count, int frames) {
+    Scene scene(w);
+    for (int i = 0; i < count; ++i) scene.Create().AddScript<T>();
+    scene.Step(0.016f); // Awake/Start
+    auto t0 = bench_clock::now();
+    for (int f = 0; f < frames; ++f) scene.StepFixed(1.0f / 60.0f);
+    return ms_since(t0) / (double)frames;
+}
+
+int main(int argc, char** argv) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 10000;
+    int frames = argc > 2 ? std::atoi(argv[2]) : 300;
+    if (count <= 0) count = 10000;
+    if (frames <= 0) frames = 300;
+
+    ecs_world_t* w = ecs_init();
+    double ms_old = 0.0, ms_new = 0.0;
+    {
+        Scene scene(w);
+        std::vector<GameObject> objects;
+        objects.reserve((size_t)count);
+        std::unordered_map<ecs_entity_t, std::vector<MongooseBehaviour*>> hosts;
+        for (int i = 0; i < count; ++i) {
+            GameObject go = scene.Create();
+            MongooseBehaviour* s = nullptr;
+            switch (i % 4) {
+                case 0: s = &go.AddScript<Spinner>(); break;
+                case 1: s = &go.AddScript<Mover>(); break;
+                case 2: s = &go.AddScript<Follower>(); break;
+                default: s = &go.AddScript<Marker>(); break;
+            }
+            hosts[(ecs_entity_t)go.id()].push_back(s);
+            objects.push_back(go);
+        }
+        scene.Step(0.016f); // Awake/Start, fills the batches
+
+        auto t0 = bench_clock::now();
+        for (int f = 0; f < frames; ++f) {
+            for (const GameObject& go : objects) {
+                auto it = hosts.find((ecs_entity_t)go.id());
+                if (it == hosts.end()) continue;
+                for (MongooseBehaviour* s : it->second) s->Update(0.016f);
+                for (MongooseBehaviour* s : it->second) s->LateUpdate();
+            }
+        }
+        ms_old = ms_since(t0) / (double)frames;
+
+        t0 = bench_clock::now();
+        for (int f = 0; f < frames; ++f) scene.Step(0.016f);
+        ms_new = ms_since(t0) / (double)frames;
+    }
+    double ms_fixed = run_fixed<Integrator>(w, count, frames);
+    double ms_fixed_jobs = run_fixed<JobIntegrator>(w, count, frames);
+
+    std::printf("script_dispatch_bench: %d scripts, %d frames\n", count, frames);
+    std::printf("%-12s %12s\n", "mode", "frame ms");
+    std::printf("%-12s %12.4f\n", "per-entity", ms_old);
+    std::printf("%-12s %12.4f\n", "batched", ms_new);
+    if (ms_new > 0.0) std::printf("speedup: %.2fx (sink %.1f)\n", ms_old / ms_new, (double)g_sink);
+    std::printf("%-12s %12.4f\n", "fixed", ms_fixed);
+    std::printf("%-12s %12.4f\n", "fixed jobs", ms_fixed_jobs);
+    if (ms_fixed_jobs > 0.0) std::printf("speedup: %.2fx\n", ms_fixed / ms_fixed_jobs);
+
+    ecs_fini(w);
+    return 0;
+}
@@ -0,0 +1,67 @@
+// Tile controller throughput: N movers running/jumping over a procedural level for a number of ticks.
+//
+// Usage: tile_controller_bench [movers=10000] [ticks=600]
+#include "ame/tile_controller.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static double now_ms(void) {
+    struct timespec ts; clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1.0e6;
+}
+
+int main(int argc, char** argv) {
+    int movers = argc > 1 ? atoi(argv[1]) : 10000;
+    int ticks = argc > 2 ? atoi(argv[2]) : 600;
+    if (movers <= 0) movers = 10000;
+    if (ticks <= 0) ticks = 600;
+
+    enum { W = 512, H = 64 };
+    static int32_t tiles[W * H];
+    static const uint8_t shapes[] = { AME_TILE_EMPTY, AME_TILE_SOLID, AME_TILE_ONE_WAY,
+                                      AME_TILE_SLOPE_UP_RIGHT, AME_TILE_SLOPE_UP_LEFT };
+    srand(7);
+    for (int c = 0; c < W; ++c) {
+        tiles[c] = 1;
+        if (c % 37 == 0) for (int r = 1; r < 4; ++r) tiles[r * W + c] = 1;       // walls
+        if (c % 11 < 5) tiles[8 * W + c] = 2;                                       // one-way ledges
+        if (c % 23 == 5) tiles[1 * W + c] = 3;                                      // slope pairs
+        if (c % 23 == 6) tiles[1 * W + c] = 1;
+        if (c % 23 == 7) tiles[1 * W + c] = 4;
+    }
+    AmeTilemapLayer layer = { W, H, tiles };
+    AmeTileGrid g;
+    ame_tile_grid_from_layer(&g, &layer, 16.0f, 16.0f, shapes, sizeof shapes);
+
+    AmeTileMover* m = (AmeTileMover*)calloc((size_t)movers, sizeof(AmeTileMover));
+    AmeTransform2D* tr = (AmeTransform2D*)calloc((size_t)movers, sizeof(AmeTransform2D));
+    if (!m || !tr) return 1;
+    for (int i = 0; i < movers; ++i) {
+        m[i].x = 24.0f + (float)(rand() % (W * 16 - 48));
+        m[i].y = 16.0f * (2.0f + (float)(rand() % 40));
+        m[i].half_w = 6.0f; m[i].half_h = 8.0f;
+        m[i].vx = (rand() & 1) ? 90.0f : -90.0f;
+    }
+
+    const float dt = 1.0f / 60.0f;
+    double t0 = now_ms();
+    for (int t = 0; t < ticks; ++t) {
+        for (int i = 0; i < movers; ++i) {
+            AmeTileMover* p = &m[i];
+            if (p->flags & (AME_TILE_HIT_WALL_LEFT | AME_TILE_HIT_WALL_RIGHT)) p->vx = -p->vx;
+            if (p->vx == 0.0f) p->vx = 90.0f;
+            if ((p->flags & AME_TILE_HIT_GROUND) && ((t + i) % 97 == 0)) p->vy = 300.0f;
+            p->vy -= 900.0f * dt;
+        }
+        ame_tile_move_batch(&g, m, (size_t)movers, dt);
+        ame_tile_movers_write_transforms(m, (size_t)movers, tr);
+    }
+    double ms = now_ms() - t0;
+    int grounded = 0;
+    for (int i = 0; i < movers; ++i) grounded += (m[i].flags & AME_TILE_HIT_GROUND) ? 1 : 0;
+    printf("tile_controller_bench: %d movers x %d ticks: %.3f ms/tick, %.1f ns/mover, grounded at end %d\n",
+           movers, ticks, ms / ticks, ms * 1.0e6 / ((double)ticks * movers), grounded);
+    free(m); free(tr);
+    return 0;
+}
@@ -1,4 +1,6 @@
 #include "Scene.h"
+#include "TransformHierarchy.h"
+#include "ame/text_system.h"
 #include <flecs.h>
 #include <cassert>
 
@@ -9,6 +11,12 @@ ecs_entity_t g_comp_script_host = 0; // id for ScriptHost
 
 void __register_script_entity(ecs_world_t* /*w*/, std::uint64_t e);
 
+// Prefab instances (IsA) read shared components from the prefab until they write their own
+// copy; per-object state is never inherited. Set before any query or observer on `id` exists.
+static void set_instancing(ecs_world_t* w, ecs_entity_t id, ecs_entity_t policy) {
+    ecs_add_pair(w, id, EcsOnInstantiate, policy);
+}
+
 // Register all façade ECS components (ids only, no behavior here)
 void ensure_components_registered(ecs_world_t* w) {
     // Transform2D (existing C struct)
@@ -28,6 +36,7 @@ void ensure_components_registered(ecs_world_t* w) {
         cdp.type.size = (int32_t)sizeof(AmePhysicsBody);
         cdp.type.alignment = (int32_t)alignof(AmePhysicsBody);
         g_comp.body = ecs_component_init(w, &cdp);
+        set_instancing(w, g_comp.body, EcsDontInherit);
     }
     // Scale2D (façade-only)
     if (g_comp.scale2d == 0) {
@@ -41,13 +50,13 @@ void ensure_components_registered(ecs_world_t* w) {
     }
     // Sprite
     if (g_comp.sprite == 0) {
-        struct SpriteData { std::uint32_t tex; float u0,v0,u1,v1; float w,h; float r,g,b,a; int visible; int sorting_layer; int order_in_layer; float z; int dirty; };
         ecs_component_desc_t cdp = (ecs_component_desc_t){0};
         ecs_entity_desc_t edp = {0}; edp.name = "Sprite";
         cdp.entity = ecs_entity_init(w, &edp);
         cdp.type.size = (int32_t)sizeof(SpriteData);
         cdp.type.alignment = (int32_t)alignof(SpriteData);
         g_comp.sprite = ecs_component_init(w, &cdp);
+        set_instancing(w, g_comp.sprite, EcsInherit);
     }
     // Material
     if (g_comp.material == 0) {
@@ -57,6 +66,7 @@ void ensure_components_registered(ecs_world_t* w) {
         cdp.type.size = (int32_t)sizeof(MaterialData);
         cdp.type.alignment = (int32_t)alignof(MaterialData);
         g_comp.material = ecs_component_init(w, &cdp);
+        set_instancing(w, g_comp.material, EcsInherit);
     }
     // Tilemap reference
     if (g_comp.tilemap == 0) {
@@ -75,6 +85,7 @@ void ensure_components_registered(ecs_world_t* w) {
         cdp.type.size = (int32_t)sizeof(MeshData);
         cdp.type.alignment = (int32_t)alignof(MeshData);
         g_comp.mesh = ecs_component_init(w, &cdp);
+        set_instancing(w, g_comp.mesh, EcsInherit);
     }
     // Camera (AmeCamera)
     if (g_comp.camera == 0) {
@@ -87,13 +98,15 @@ void ensure_components_registered(ecs_world_t* w) {
     }
     // Text (engine-managed pointer)
     if (g_comp.text == 0) {
-        struct TextData { const char* text_ptr; std::uint32_t font; float r,g,b,a; float size; int wrap_px; int request_set; char request_buf[256]; };
         ecs_component_desc_t cdp = (ecs_component_desc_t){0};
         ecs_entity_desc_t edp = {0}; edp.name = "Text";
         cdp.entity = ecs_entity_init(w, &edp);
         cdp.type.size = (int32_t)sizeof(TextData);
         cdp.type.alignment = (int32_t)alignof(TextData);
         g_comp.text = ecs_component_init(w, &cdp);
+        set_instancing(w, g_comp.text, EcsDontInherit);
+        // Text arena and the systems that apply requests and release strings
+        ame_text_system_register(w);
     }
     // Collider2D
     if (g_comp.collider2d == 0) {
@@ -104,6 +117,17 @@ void ensure_components_registered(ecs_world_t* w) {
         cdp.type.size = (int32_t)sizeof(Col2D);
         cdp.type.alignment = (int32_t)alignof(Col2D);
         g_comp.collider2d = ecs_component_init(w, &cdp);
+        set_instancing(w, g_comp.collider2d, EcsInherit);
+    }
+    // World transform cache, added automatically with AmeTransform2D (With trait)
+    if (g_comp.world_transform == 0) {
+        ecs_component_desc_t cdp = (ecs_component_desc_t){0};
+        ecs_entity_desc_t edp = {0}; edp.name = "WorldTransform2D";
+        cdp.entity = ecs_entity_init(w, &edp);
+        cdp.type.size = (int32_t)sizeof(AmeWorldTransform2D);
+        cdp.type.alignment = (int32_t)alignof(AmeWorldTransform2D);
+        g_comp.world_transform = ecs_component_init(w, &cdp);
+        ecs_add_pair(w, g_comp.transform, EcsWith, g_comp.world_transform);
     }
     // Script host
     if (g_comp_script_host == 0) {
@@ -113,6 +137,7 @@ void ensure_components_registered(ecs_world_t* w) {
         cdp.type.size = (int32_t)sizeof(ScriptHost);
         cdp.type.alignment = (int32_t)alignof(ScriptHost);
         g_comp_script_host = ecs_component_init(w, &cdp);
+        set_instancing(w, g_comp_script_host, EcsDontInherit);
     }
 }
 
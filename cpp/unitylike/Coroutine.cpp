@@ -0,0 +1,200 @@
+#include "Scene.h"
+#include "Coroutine.h"
+#include <cmath>
+#include <vector>
+
+namespace unitylike {
+
+namespace {
+
+struct Entry {
+    Coroutine::Handle h;
+    MongooseBehaviour* owner = nullptr;
+    std::uint32_t gen = 0;
+    bool running = false;
+    bool stop = false; // stopped while running; destroyed once it suspends
+};
+
+struct Timer {
+    CoroutineId id;
+    double due; // seconds, or frame number in the frame ring
+};
+
+// Time waits hash into a wheel of kWheelSlots ticks of 1/kTicksPerSecond s (a 4 s rotation).
+// A frame visits only the slots its dt touched and resumes the due entries; sleeps longer than
+// a rotation are seen once per rotation and stay put. Frame waits use a ring of frame slots.
+constexpr std::uint32_t kWheelSlots = 512;
+constexpr double kTicksPerSecond = 128.0;
+constexpr std::uint32_t kFrameSlots = 64;
+
+std::vector<Entry> g_entries;
+std::vector<std::uint32_t> g_free_slots;
+std::vector<Timer> g_wheel[kWheelSlots];
+std::vector<Timer> g_frame_ring[kFrameSlots];
+std::vector<CoroutineId> g_fixed_waiters;
+std::vector<CoroutineId> g_signaled;
+std::vector<CoroutineId> g_ready; // scratch, reused every pass
+double g_time = 0.0;
+std::uint64_t g_tick = 0;
+std::uint64_t g_frame = 0;
+
+Entry* entry_of(CoroutineId id) {
+    if (id.slot >= g_entries.size()) return nullptr;
+    Entry& e = g_entries[id.slot];
+    if (!e.h || e.gen != id.gen) return nullptr;
+    return &e;
+}
+
+// The owner may be deleted right after stopping its coroutines
+void detach(Entry& e) {
+    if (e.owner && e.owner->__coroutines) e.owner->__coroutines--;
+    e.owner = nullptr;
+}
+
+void release(std::uint32_t slot) {
+    Entry& e = g_entries[slot];
+    e.h.destroy();
+    e.h = {};
+    detach(e);
+    e.gen++; // outstanding waits on the wheel, ring or events go stale
+    e.running = false;
+    e.stop = false;
+    g_free_slots.push_back(slot);
+}
+
+void resume(CoroutineId id) {
+    Entry* e = entry_of(id);
+    if (!e || e->running) return;
+    e->running = true;
+    e->h.resume();
+    // g_entries may have grown while it ran (nested StartCoroutine)
+    Entry& after = g_entries[id.slot];
+    after.running = false;
+    if (after.stop || after.h.done()) release(id.slot);
+}
+
+void resume_ready() {
+    // Swap out: resumed coroutines may wait again or start others while we iterate
+    std::vector<CoroutineId> ready;
+    ready.swap(g_ready);
+    for (CoroutineId id : ready) resume(id);
+    ready.clear();
+    if (g_ready.empty()) g_ready.swap(ready);
+}
+
+void collect_due(std::vector<Timer>& slot, double now) {
+    for (std::size_t i = 0; i < slot.size();) {
+        if (slot[i].due <= now) {
+            g_ready.push_back(slot[i].id);
+            slot[i] = slot.back();
+            slot.pop_back();
+        } else {
+            ++i;
+        }
+    }
+}
+
+} // namespace
+
+CoroutineId __coroutine_start(MongooseBehaviour* owner, Coroutine co) {
+    if (__job_forbidden("StartCoroutine")) return CoroutineId{};
+    Coroutine::Handle h = co.__release();
+    if (!h) return CoroutineId{};
+    std::uint32_t slot;
+    if (!g_free_slots.empty()) {
+        slot = g_free_slots.back();
+        g_free_slots.pop_back();
+    } else {
+        slot = (std::uint32_t)g_entries.size();
+        g_entries.emplace_back();
+    }
+    Entry& e = g_entries[slot];
+    e.h = h;
+    e.owner = owner;
+    if (owner) owner->__coroutines++;
+    CoroutineId id{ slot, e.gen };
+    h.promise().id = id;
+    resume(id);
+    return id;
+}
+
+void __coroutine_stop(CoroutineId id) {
+    Entry* e = entry_of(id);
+    if (!e) return;
+    if (e->running) { e->stop = true; detach(*e); return; }
+    release(id.slot);
+}
+
+void __coroutine_stop_all(MongooseBehaviour* owner) {
+    for (std::uint32_t i = 0; i < g_entries.size() && owner->__coroutines; ++i) {
+        Entry& e = g_entries[i];
+        if (!e.h || e.owner != owner) continue;
+        if (e.running) { e.stop = true; detach(e); continue; }
+        release(i);
+    }
+}
+
+CoroutineId MongooseBehaviour::StartCoroutine(Coroutine co) { return __coroutine_start(this, std::move(co)); }
+void MongooseBehaviour::StopCoroutine(CoroutineId id) { __coroutine_stop(id); }
+
+void __coroutine_wait_seconds(CoroutineId id, float seconds) {
+    // Strictly after now, so even a zero wait yields for a frame
+    double due = g_time + (seconds > 0.0f ? (double)seconds : 0.0);
+    if (due <= g_time) due = std::nextafter(g_time, 1e300);
+    g_wheel[(std::uint64_t)(due * kTicksPerSecond) % kWheelSlots].push_back(Timer{ id, due });
+}
+
+void __coroutine_wait_frames(CoroutineId id, int frames) {
+    std::uint64_t due = g_frame + (std::uint64_t)(frames > 1 ? frames : 1);
+    g_frame_ring[due % kFrameSlots].push_back(Timer{ id, (double)due });
+}
+
+void __coroutine_wait_fixed_update(CoroutineId id) {
+    g_fixed_waiters.push_back(id);
+}
+
+void __coroutine_signal(const CoroutineId* ids, std::size_t n) {
+    g_signaled.insert(g_signaled.end(), ids, ids + n);
+}
+
+void __coroutines_update(float dt) {
+    g_time += (double)(dt > 0.0f ? dt : 0.0f);
+    g_frame++;
+    collect_due(g_frame_ring[g_frame % kFrameSlots], (double)g_frame);
+
+    // From the tick the last frame ended in (its later part may be due now) through the current
+    // one; every slot once at most, however long the frame was
+    std::uint64_t now = (std::uint64_t)(g_time * kTicksPerSecond);
+    std::uint64_t steps = now - g_tick + 1;
+    if (steps > kWheelSlots) steps = kWheelSlots;
+    for (std::uint64_t t = now + 1 - steps; t <= now; ++t) collect_due(g_wheel[t % kWheelSlots], g_time);
+    g_tick = now;
+
+    if (!g_signaled.empty()) {
+        g_ready.insert(g_ready.end(), g_signaled.begin(), g_signaled.end());
+        g_signaled.clear();
+    }
+    if (!g_ready.empty()) resume_ready();
+}
+
+void __coroutines_fixed_update() {
+    if (g_fixed_waiters.empty()) return;
+    std::vector<CoroutineId> waiters;
+    waiters.swap(g_fixed_waiters);
+    for (CoroutineId id : waiters) resume(id);
+    waiters.clear();
+    if (g_fixed_waiters.empty()) g_fixed_waiters.swap(waiters);
+}
+
+void __coroutines_clear() {
+    for (std::uint32_t i = 0; i < g_entries.size(); ++i) {
+        if (g_entries[i].h) release(i);
+    }
+    for (auto& s : g_wheel) s.clear();
+    for (auto& s : g_frame_ring) s.clear();
+    g_fixed_waiters.clear();
+    g_signaled.clear();
+    g_ready.clear();
+}
+
+} // namespace unitylike
@@ -0,0 +1,127 @@
+#pragma once
+
+// C++20 coroutines for MongooseBehaviour (Unity's StartCoroutine / yield instructions).
+//
+//   Coroutine Blink() {
+//       for (;;) { co_await WaitForSeconds(0.5f); sprite.enabled(!sprite.enabled()); }
+//   }
+//   void Start() override { StartCoroutine(Blink()); }
+//
+// Sleeping coroutines are held by the scheduler (Coroutine.cpp), not polled: time waits sit in
+// a timer wheel, frame waits in a frame ring, event waits on the event itself. Update-phase
+// waits resume after the Update batches and before LateUpdate; WaitForFixedUpdate resumes
+// after the FixedUpdate batches. Logic thread only.
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace unitylike {
+
+class MongooseBehaviour;
+
+// Identifies a started coroutine; stale once it finished or was stopped
+struct CoroutineId {
+    std::uint32_t slot = UINT32_MAX;
+    std::uint32_t gen = 0;
+    explicit operator bool() const { return slot != UINT32_MAX; }
+};
+
+// Return type of coroutine methods. Suspended until passed to StartCoroutine, which takes
+// ownership of the frame.
+class Coroutine {
+public:
+    struct promise_type {
+        CoroutineId id;
+        Coroutine get_return_object() { return Coroutine(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+    using Handle = std::coroutine_handle<promise_type>;
+
+    Coroutine() = default;
+    Coroutine(Coroutine&& o) noexcept : h_(std::exchange(o.h_, {})) {}
+    Coroutine& operator=(Coroutine&& o) noexcept {
+        if (this != &o) { if (h_) h_.destroy(); h_ = std::exchange(o.h_, {}); }
+        return *this;
+    }
+    Coroutine(const Coroutine&) = delete;
+    Coroutine& operator=(const Coroutine&) = delete;
+    ~Coroutine() { if (h_) h_.destroy(); }
+
+    // Internal: hand the frame to the scheduler
+    Handle __release() { return std::exchange(h_, {}); }
+private:
+    explicit Coroutine(Handle h) : h_(h) {}
+    Handle h_{};
+};
+
+// Internal: scheduler entry points (Coroutine.cpp)
+CoroutineId __coroutine_start(MongooseBehaviour* owner, Coroutine co);
+void __coroutine_stop(CoroutineId id);
+void __coroutine_stop_all(MongooseBehaviour* owner);
+void __coroutine_wait_seconds(CoroutineId id, float seconds);
+void __coroutine_wait_frames(CoroutineId id, int frames);
+void __coroutine_wait_fixed_update(CoroutineId id);
+void __coroutine_signal(const CoroutineId* ids, std::size_t n);
+// Internal: called from the script phases (SceneCore.cpp)
+void __coroutines_update(float dt);
+void __coroutines_fixed_update();
+void __coroutines_clear();
+
+// Scaled time; at least one frame even for seconds <= 0
+struct WaitForSeconds {
+    explicit WaitForSeconds(float s) : seconds(s) {}
+    float seconds;
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(Coroutine::Handle h) const { __coroutine_wait_seconds(h.promise().id, seconds); }
+    void await_resume() const noexcept {}
+};
+
+// Resumes `frames` Update phases later (at least one)
+struct WaitForFrames {
+    explicit WaitForFrames(int n) : frames(n) {}
+    int frames;
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(Coroutine::Handle h) const { __coroutine_wait_frames(h.promise().id, frames); }
+    void await_resume() const noexcept {}
+};
+
+// Resumes after the next FixedUpdate phase
+struct WaitForFixedUpdate {
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(Coroutine::Handle h) const { __coroutine_wait_fixed_update(h.promise().id); }
+    void await_resume() const noexcept {}
+};
+
+// Something coroutines can wait for. Signal wakes the coroutines waiting at that moment; they
+// resume in the next Update phase. Not remembered: waiting after a Signal waits for the next.
+class CoroutineEvent {
+public:
+    void Signal() {
+        if (waiters_.empty()) return;
+        __coroutine_signal(waiters_.data(), waiters_.size());
+        waiters_.clear();
+    }
+    bool HasWaiters() const { return !waiters_.empty(); }
+
+    // Internal: used by WaitUntil
+    void __add_waiter(CoroutineId id) { waiters_.push_back(id); }
+private:
+    std::vector<CoroutineId> waiters_;
+};
+
+struct WaitUntil {
+    explicit WaitUntil(CoroutineEvent& e) : event(&e) {}
+    CoroutineEvent* event;
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(Coroutine::Handle h) const { event->__add_waiter(h.promise().id); }
+    void await_resume() const noexcept {}
+};
+
+} // namespace unitylike
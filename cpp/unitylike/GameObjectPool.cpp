@@ -0,0 +1,202 @@
+#include "Scene.h"
+#include "ame/text_system.h"
+#include "ame/physics_activation.h"
+#include <cstring>
+
+namespace unitylike {
+
+GameObjectPool& Scene::CreatePool(const GameObject& prefab, std::size_t capacity, AmePhysicsWorld* physics,
+                                  std::function<void(GameObject&)> init) {
+    pools_.push_back(std::make_unique<GameObjectPool>(this, (ecs_entity_t)prefab.id(), capacity, physics, std::move(init)));
+    return *pools_.back();
+}
+
+GameObjectPool::GameObjectPool(Scene* scene, ecs_entity_t prefab, std::size_t capacity, AmePhysicsWorld* physics,
+                               std::function<void(GameObject&)> init)
+    : scene_(scene), prefab_(prefab), physics_(physics), init_(std::move(init)) {
+    ecs_world_t* w = scene_->world();
+    ensure_components_registered(w);
+    instanced_ = prefab_ && ecs_has_id(w, prefab_, EcsPrefab);
+    // Components with a value; pairs (name, hierarchy) and tags (EcsDisabled) are not copied.
+    // The body and the text string get per-object copies instead.
+    if (const ecs_type_t* type = prefab_ ? ecs_get_type(w, prefab_) : nullptr) {
+        for (int32_t i = 0; i < type->count; ++i) {
+            ecs_id_t id = type->array[i];
+            if (ecs_id_is_pair(id)) continue;
+            const ecs_type_info_t* ti = ecs_get_type_info(w, id);
+            if (!ti || ti->size == 0) continue;
+            if (id == g_comp.body) { has_body_ = physics_ != nullptr; continue; }
+            if (id == g_comp.text) { has_text_ = true; continue; }
+            bool shared = instanced_ && ecs_has_pair(w, (ecs_entity_t)id, EcsOnInstantiate, EcsInherit);
+            components_.push_back(CopiedComponent{ (ecs_entity_t)id, (std::size_t)ti->size, shared, ti->hooks.copy != nullptr });
+        }
+    }
+    entities_.reserve(capacity);
+    free_.reserve(capacity);
+    in_use_.reserve(capacity);
+    index_.reserve(capacity);
+    for (std::size_t i = 0; i < capacity; ++i) free_.push_back(clone());
+}
+
+// A disabled copy of the prefab with its own body (held) and text string
+ecs_entity_t GameObjectPool::clone() {
+    ecs_world_t* w = scene_->world();
+    ecs_entity_t e = ecs_new(w);
+    ecs_add_id(w, e, EcsDisabled);
+    if (instanced_) ecs_add_pair(w, e, EcsIsA, prefab_);
+    for (const CopiedComponent& c : components_) {
+        if (c.shared) continue;
+        if (const void* v = ecs_get_id(w, prefab_, c.id)) ecs_set_id(w, e, c.id, c.size, v);
+    }
+    if (has_text_) {
+        if (const TextData* src = (const TextData*)ecs_get_id(w, prefab_, g_comp.text)) {
+            TextData td = *src;
+            if (src->text_ptr) td.text_ptr = ame_text_store(w, src->text_ptr, std::strlen(src->text_ptr));
+            ecs_set_id(w, e, g_comp.text, sizeof td, &td);
+        }
+    }
+    if (has_body_) {
+        const AmePhysicsBody* src = (const AmePhysicsBody*)ecs_get_id(w, prefab_, g_comp.body);
+        if (src && src->body) {
+            float x = 0.0f, y = 0.0f;
+            ame_physics_get_position(src->body, &x, &y);
+            AmePhysicsBody pb = *src;
+            pb.body = ame_physics_clone_body(physics_, src->body, x, y, ame_physics_get_angle(src->body));
+            pb.handle = ame_physics_body_handle(physics_, pb.body);
+            ame_physics_body_set_entity(physics_, pb.handle, e);
+            ame_physics_body_set_held(physics_, pb.handle, true);
+            if (pb.body) ecs_set_id(w, e, g_comp.body, sizeof pb, &pb);
+        }
+    }
+    index_.emplace(e, entities_.size());
+    entities_.push_back(e);
+    in_use_.push_back(0);
+    if (init_) {
+        GameObject go(scene_, (GameObject::Entity)e);
+        init_(go);
+        __set_scripts_dispatched(e, false); // parked until Acquire
+    }
+    return e;
+}
+
+// Drop a copy destroyed behind the pool's back (swap-remove from entities_)
+void GameObjectPool::forget(ecs_entity_t e) {
+    auto it = index_.find(e);
+    if (it == index_.end()) return;
+    std::size_t slot = it->second;
+    index_.erase(it);
+    std::size_t last = entities_.size() - 1;
+    if (slot != last) {
+        entities_[slot] = entities_[last];
+        in_use_[slot] = in_use_[last];
+        index_[entities_[slot]] = slot;
+    }
+    entities_.pop_back();
+    in_use_.pop_back();
+}
+
+// Copy the prefab's values over the ones that changed since the last Acquire
+void GameObjectPool::reset(ecs_entity_t e) {
+    ecs_world_t* w = scene_->world();
+    for (const CopiedComponent& c : components_) {
+        if (c.shared) {
+            // Drop the instance's own copy, if a setter made one, to read the prefab's again
+            if (ecs_owns_id(w, e, c.id)) ecs_remove_id(w, e, c.id);
+            continue;
+        }
+        const void* src = ecs_get_id(w, prefab_, c.id);
+        if (!src) continue;
+        if (c.hooked) {
+            // A byte compare or copy would alias owned pointers; the copy hook does it right
+            ecs_set_id(w, e, c.id, c.size, src);
+            continue;
+        }
+        void* dst = ecs_get_mut_id(w, e, c.id);
+        if (!dst) { ecs_set_id(w, e, c.id, c.size, src); continue; }
+        if (std::memcmp(dst, src, c.size) == 0) continue;
+        std::memcpy(dst, src, c.size);
+        if (c.id == g_comp.collider2d) static_cast<Col2D*>(dst)->dirty = 1; // refit the body's fixture
+        ecs_modified_id(w, e, c.id);
+    }
+    if (!has_text_) return;
+    const TextData* src = (const TextData*)ecs_get_id(w, prefab_, g_comp.text);
+    if (!src) return;
+    const char* want = src->text_ptr ? src->text_ptr : "";
+    bool restring = false;
+    {
+        // text_ptr stays: the string goes through the arena like TextRenderer::text
+        ComponentEdit<TextData> td(w, e, g_comp.text);
+        if (!td) return;
+        restring = !td->text_ptr || std::strcmp(td->text_ptr, want) != 0;
+        td->font = src->font;
+        td->r = src->r; td->g = src->g; td->b = src->b; td->a = src->a;
+        td->size = src->size;
+        td->wrap_px = src->wrap_px;
+    }
+    if (restring && ame_text_request(w, e, want, std::strlen(want)) && !ecs_is_deferred(w)) ame_text_apply_requests(w);
+}
+
+GameObject GameObjectPool::acquire(const AmeTransform2D* place) {
+    if (__job_forbidden("GameObjectPool::Acquire")) return GameObject();
+    ecs_world_t* w = scene_->world();
+    ecs_entity_t e = 0;
+    while (!free_.empty() && !e) {
+        e = free_.back();
+        free_.pop_back();
+        if (!ecs_is_alive(w, e)) { forget(e); e = 0; } // destroyed behind the pool's back
+    }
+    if (!e) e = clone();
+    in_use_[index_[e]] = 1;
+
+    ecs_remove_id(w, e, EcsDisabled);
+    reset(e);
+    if (place) {
+        ComponentEdit<AmeTransform2D> tr(w, e, g_comp.transform);
+        if (tr) *tr = *place;
+    }
+    if (has_body_) {
+        const AmePhysicsBody* pb = (const AmePhysicsBody*)ecs_get_id(w, e, g_comp.body);
+        if (pb && pb->body) {
+            if (place) {
+                ame_physics_set_position(pb->body, place->x, place->y);
+                ame_physics_set_angle(pb->body, place->angle);
+            }
+            ame_physics_set_velocity(pb->body, 0.0f, 0.0f);
+            ame_physics_set_angular_velocity(pb->body, 0.0f);
+            ame_physics_body_set_held(physics_, pb->handle, false);
+        }
+    }
+    __set_scripts_dispatched(e, true);
+    return GameObject(scene_, (GameObject::Entity)e);
+}
+
+GameObject GameObjectPool::Acquire() {
+    const AmeTransform2D* tr = (const AmeTransform2D*)ecs_get_id(scene_->world(), prefab_, g_comp.transform);
+    if (!tr) return acquire(nullptr);
+    AmeTransform2D place = *tr;
+    return acquire(&place);
+}
+
+GameObject GameObjectPool::Acquire(const glm::vec2& position, float angle) {
+    AmeTransform2D place = { position.x, position.y, angle };
+    return acquire(&place);
+}
+
+void GameObjectPool::Release(GameObject& go) {
+    if (__job_forbidden("GameObjectPool::Release")) return;
+    auto it = index_.find((ecs_entity_t)go.id());
+    if (it == index_.end() || !in_use_[it->second]) return; // not from this pool, or released
+    ecs_world_t* w = scene_->world();
+    ecs_entity_t e = it->first;
+    if (!ecs_is_alive(w, e)) { forget(e); return; } // destroyed while in use: nothing to park
+    in_use_[it->second] = 0;
+    __set_scripts_dispatched(e, false);
+    if (has_body_) {
+        if (const AmePhysicsBody* pb = (const AmePhysicsBody*)ecs_get_id(w, e, g_comp.body))
+            ame_physics_body_set_held(physics_, pb->handle, true);
+    }
+    ecs_add_id(w, e, EcsDisabled);
+    free_.push_back(e);
+}
+
+} // namespace unitylike
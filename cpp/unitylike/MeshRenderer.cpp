@@ -4,8 +4,9 @@ namespace unitylike {
 
 void MeshRenderer::setData(const float* positions, const float* uvs, const float* colors, std::size_t vertCount) {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
-    MeshData mr{positions, uvs, colors, vertCount};
-    ecs_set_id(w, (ecs_entity_t)owner_.id(), g_comp.mesh, sizeof mr, &mr);
+    // In place (job-safe) when the mesh exists; adding one is refused inside a job
+    ComponentEdit<MeshData> mr(w, owner_.id(), g_comp.mesh);
+    if (mr) *mr = MeshData{positions, uvs, colors, vertCount};
 }
 std::size_t MeshRenderer::vertexCount() const {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
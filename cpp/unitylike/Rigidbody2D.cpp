@@ -12,6 +12,7 @@ glm::vec2 Rigidbody2D::velocity() const {
 }
 
 void Rigidbody2D::velocity(const glm::vec2& v) {
+    if (__job_forbidden("Rigidbody2D::velocity")) return; // Box2D may wake the body's island
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
     AmePhysicsBody* pb = (AmePhysicsBody*)ecs_get_id(w, (ecs_entity_t)owner_.id(), g_comp.body);
     if (!pb || !pb->body) return;
@@ -5,6 +5,9 @@
 
 #include <string>
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 #include <type_traits>
 #include <glm/vec2.hpp>
@@ -20,20 +23,44 @@ extern "C" {
 }
 
 struct ecs_world_t; // from flecs
+struct AmeSnapshotFile; // ame/ecs_snapshot.h
 
 namespace unitylike {
 
 class GameObject;
+class GameObjectPool;
 class Transform;
 class MongooseBehaviour;
+// Coroutine.h (C++20): only scripts that write coroutines include it
+class Coroutine;
+struct CoroutineId;
+void __coroutine_stop_all(MongooseBehaviour* owner);
 
 // Internal script host storage (managed outside ECS to avoid POD constraints)
 struct ScriptHost {
     std::vector<MongooseBehaviour*> scripts;
     bool awoken = false;
     bool started = false;
+    bool queued = false; // waiting for the next Awake/Start pass
+    bool dispatched = true; // false while parked in a GameObjectPool: Start leaves it out of the batches
 };
 
+// Internal: every started script of one concrete type, stored densely. Phases only visit batches
+// whose type overrides that callback; the dispatchers loop one type at a time and call the
+// override non-virtually when it is accessible. Destroyed slots are nulled and compacted after
+// the phase so scripts may destroy objects mid-dispatch.
+struct ScriptBatch {
+    std::vector<MongooseBehaviour*> scripts;
+    std::size_t holes = 0;
+    void (*update)(MongooseBehaviour* const* s, std::size_t n, float dt) = nullptr;
+    void (*fixed_update)(MongooseBehaviour* const* s, std::size_t n, float fdt) = nullptr;
+    void (*late_update)(MongooseBehaviour* const* s, std::size_t n) = nullptr;
+    bool job_safe = false; // FixedUpdate may run on the worker pool (ScriptJobSafeTrait)
+};
+// Internal: allocate a batch and list it in the phases it has callbacks for
+ScriptBatch* __register_script_batch(const ScriptBatch& proto);
+template<typename T> ScriptBatch* __script_batch();
+
 // Internal: component id for ScriptHost (registered by Scene)
 extern ecs_entity_t g_comp_script_host;
 // Internal: register an entity as having scripts (used by AddScript)
@@ -42,6 +69,9 @@ void __register_script_entity(ecs_world_t* w, std::uint64_t e);
 ScriptHost* __get_script_host(std::uint64_t e);
 void __ensure_script_host(std::uint64_t e);
 void __remove_script_host(std::uint64_t e);
+// Internal: take an entity's scripts out of the dispatch batches, or put them back (scripts not
+// started yet are inserted by the start pass only when dispatched)
+void __set_scripts_dispatched(std::uint64_t e, bool dispatched);
 
 // Forward declaration of internal component id holder
 struct CompIds {
@@ -55,13 +85,16 @@ struct CompIds {
     ecs_entity_t camera;
     ecs_entity_t text;
     ecs_entity_t collider2d;
+    ecs_entity_t world_transform; // cached AmeWorldTransform2D (TransformHierarchy.h)
 };
 extern CompIds g_comp;
 
 // Internal component PODs (façade data stored in ECS)
+// SpriteData and TextData hold only what the render extraction reads; text requests queue
+// outside the table in the text arena (ame/text_system.h).
 struct Scale2D { float sx; float sy; };
-struct SpriteData { std::uint32_t tex; float u0,v0,u1,v1; float w,h; float r,g,b,a; int visible; int sorting_layer; int order_in_layer; float z; int dirty; };
-struct MaterialData { std::uint32_t tex; float r,g,b,a; int dirty; };
+struct SpriteData { std::uint32_t tex; float u0,v0,u1,v1; float w,h; float r,g,b,a; int visible; int sorting_layer; int order_in_layer; float z; };
+struct MaterialData { std::uint32_t tex; float r,g,b,a; };
 struct TilemapRefData {
     AmeTilemap* map; // pointer to CPU-side map (layer0 data)
     int layer;       // layer index in source TMX
@@ -75,12 +108,24 @@ struct TilemapRefData {
     int map_w, map_h; // store map size to avoid dangling pointers to TMX local
 };
 struct MeshData { const float* pos; const float* uv; const float* col; std::size_t count; };
-struct TextData { const char* text_ptr; std::uint32_t font; float r,g,b,a; float size; int wrap_px; int request_set; char request_buf[256]; };
+struct TextData { const char* text_ptr; std::uint32_t font; float r,g,b,a; float size; int wrap_px; }; // text_ptr: text arena
 struct Col2D { int type; float w,h; float radius; int isTrigger; int dirty; };
 
 // Internal registration helper (defined in Components.cpp)
 void ensure_components_registered(ecs_world_t* w);
 
+// Per-component initial values for Scene::CreateBulk. Each non-null array holds `count` entries;
+// components left null are not added.
+struct BulkSpawn {
+    const AmeTransform2D* transforms = nullptr;
+    const Scale2D* scales = nullptr;
+    const SpriteData* sprites = nullptr;
+    const MaterialData* materials = nullptr;
+    const Col2D* colliders = nullptr;
+    const AmePhysicsBody* bodies = nullptr;
+    std::uint64_t prefab = 0; // Scene::CreatePrefab object the spawns are instances of
+};
+
 class Scene {
 public:
     // Create a façade Scene over an existing Flecs world (owned by C core)
@@ -91,16 +136,103 @@ public:
     GameObject Create(const std::string& name = "");
     void Destroy(GameObject& go);
     GameObject Find(const std::string& name);
+    // Spawn `count` unnamed GameObjects straight into their final archetype (bullets, tiles)
+    std::vector<GameObject> CreateBulk(std::size_t count, const BulkSpawn& spawn);
+    // Prefabs: a template object that is never updated or drawn itself. Instances share its
+    // Sprite, Material, Mesh and Collider2D (Flecs IsA) until a setter on the instance writes
+    // its own copy; Transform and Scale are copied per instance, bodies, mesh colliders, text and
+    // scripts are not.
+    GameObject CreatePrefab(const std::string& name = "");
+    GameObject Instantiate(const GameObject& prefab);
+    // Recycled copies of `prefab` for short-lived spawns (GameObjectPool). With `physics`, each
+    // copy gets its own clone of the prefab's body. Copies of a CreatePrefab object are instances
+    // that share its components. `init` runs once per copy, when it is created (disabled), e.g. to
+    // add its scripts; they wake and start at the next Step but only update while acquired. The
+    // pool lives as long as the Scene.
+    GameObjectPool& CreatePool(const GameObject& prefab, std::size_t capacity, AmePhysicsWorld* physics = nullptr,
+                               std::function<void(GameObject&)> init = {});
+
+    // Binary snapshot (ame/ecs_snapshot.h) of the façade components, hierarchy and names.
+    // Loading adds the saved objects to this scene; mesh data stays mapped until the Scene dies.
+    bool SaveSnapshot(const std::string& path);
+    bool LoadSnapshot(const std::string& path);
 
     // Tick
     void Step(float dt);
     void StepFixed(float fdt);
 
+    // Job-safe FixedUpdate (ScriptJobSafeTrait) debug mode: each script may only write its own
+    // entity; other writes are skipped, logged and counted. Forbidden calls are always counted.
+    static void SetJobSafetyChecks(bool on);
+    static std::size_t JobSafetyViolations();
 
     // Access underlying world
     ecs_world_t* world() const { return world_; }
 private:
     ecs_world_t* world_ = nullptr; // not owned
+    std::vector<AmeSnapshotFile*> snapshots_; // loaded snapshot files, closed in ~Scene
+    std::vector<std::unique_ptr<GameObjectPool>> pools_;
+};
+
+// Batches the change notifications of façade setters made on this thread. Setters still write
+// in place; each (entity, component) they touch gets one ecs_modified_id when the scope ends
+// instead of one per setter. Scopes nest; the innermost one for the same world collects.
+//
+//     { EditScope edit(scene); sr.color(c); sr.size(s); sr.z(1.0f); } // one OnSet for Sprite
+class EditScope {
+public:
+    explicit EditScope(Scene& scene);
+    ~EditScope();
+    EditScope(const EditScope&) = delete;
+    EditScope& operator=(const EditScope&) = delete;
+
+    ecs_world_t* world() const { return world_; }
+    void touch(ecs_entity_t e, ecs_entity_t component);
+private:
+    ecs_world_t* world_;
+    EditScope* prev_;
+    std::vector<std::pair<ecs_entity_t, ecs_entity_t>> touched_;
+};
+// Internal: innermost EditScope of this thread (SceneCore.cpp)
+EditScope* __current_edit_scope();
+
+// Internal: set on a thread while it runs job-safe FixedUpdate scripts (SceneCore.cpp). Writes
+// there never add components, and their modified notifications fire after the join.
+extern thread_local bool __t_script_job;
+void* __job_component(ecs_world_t* w, ecs_entity_t e, ecs_entity_t component);
+void __job_touch(ecs_world_t* w, ecs_entity_t e, ecs_entity_t component);
+// Internal: true (and counted as a violation) when called from a job-safe FixedUpdate
+bool __job_forbidden(const char* what);
+// Internal: a script AddScript refused in a job; deleted on the logic thread after the join
+void __job_discard_script(MongooseBehaviour* script);
+
+// Internal: write access to one façade component in place. ecs_ensure_id adds the component
+// zeroed when missing; the change is announced once, when the edit ends (or by the EditScope).
+template<typename T>
+class ComponentEdit {
+public:
+    ComponentEdit(ecs_world_t* w, std::uint64_t e, ecs_entity_t component)
+        : w_(w), e_((ecs_entity_t)e), id_(component),
+          ptr_(static_cast<T*>(__t_script_job ? __job_component(w, (ecs_entity_t)e, component)
+                                              : ecs_ensure_id(w, (ecs_entity_t)e, component))) {}
+    ~ComponentEdit() {
+        if (!ptr_) return;
+        if (__t_script_job) { __job_touch(w_, e_, id_); return; }
+        EditScope* scope = __current_edit_scope();
+        if (scope && scope->world() == w_) scope->touch(e_, id_);
+        else ecs_modified_id(w_, e_, id_);
+    }
+    ComponentEdit(const ComponentEdit&) = delete;
+    ComponentEdit& operator=(const ComponentEdit&) = delete;
+
+    explicit operator bool() const { return ptr_ != nullptr; }
+    T* operator->() const { return ptr_; }
+    T& operator*() const { return *ptr_; }
+private:
+    ecs_world_t* w_;
+    ecs_entity_t e_;
+    ecs_entity_t id_;
+    T* ptr_;
 };
 
 class GameObject {
@@ -141,6 +273,47 @@ private:
     mutable std::string name_cache_;
 };
 
+// Objects for bullets, sparks and floating text, cloned from a prefab once and then recycled.
+// Released objects stay alive but disabled (EcsDisabled): their scripts leave the dispatch
+// batches and their physics body is held (ame_physics_body_set_held) instead of destroyed.
+// Acquire copies the prefab's component values back over whatever the last user changed. Only
+// an empty pool allocates (one more clone).
+class GameObjectPool {
+public:
+    GameObject Acquire();
+    // Placed before it is enabled; the body is teleported and stopped
+    GameObject Acquire(const glm::vec2& position, float angle = 0.0f);
+    void Release(GameObject& go);
+
+    std::size_t size() const { return entities_.size(); }
+    std::size_t available() const { return free_.size(); }
+
+    GameObjectPool(Scene* scene, ecs_entity_t prefab, std::size_t capacity, AmePhysicsWorld* physics,
+                   std::function<void(GameObject&)> init);
+    GameObjectPool(const GameObjectPool&) = delete;
+    GameObjectPool& operator=(const GameObjectPool&) = delete;
+private:
+    // shared: read via IsA; hooked: has a copy hook (e.g. MeshCollider2D owns its cache), so
+    // values are only ever copied through ecs_set_id
+    struct CopiedComponent { ecs_entity_t id; std::size_t size; bool shared; bool hooked; };
+    ecs_entity_t clone();
+    GameObject acquire(const AmeTransform2D* place);
+    void reset(ecs_entity_t e);
+    void forget(ecs_entity_t e);
+
+    Scene* scene_;
+    ecs_entity_t prefab_;
+    AmePhysicsWorld* physics_;
+    std::function<void(GameObject&)> init_;
+    std::vector<CopiedComponent> components_; // prefab components with values, minus body/text
+    bool has_body_ = false, has_text_ = false;
+    bool instanced_ = false; // prefab_ is a Scene::CreatePrefab object: copies are IsA instances
+    std::vector<ecs_entity_t> entities_;
+    std::vector<ecs_entity_t> free_;
+    std::unordered_map<ecs_entity_t, std::size_t> index_; // entity -> entities_ slot
+    std::vector<std::uint8_t> in_use_;
+};
+
 class Transform {
 public:
     // Internal: constructs a Transform view bound to a specific owner GameObject
@@ -154,7 +327,8 @@ public:
     glm::vec3 localScale() const;
     void localScale(const glm::vec3& s);
 
-    // World/composed accessors (read-only): computed by traversing EcsChildOf chain
+    // World/composed accessors (read-only): read from the cached WorldTransform2D, which is
+    // re-propagated first when any transform changed since the last propagation
     glm::vec3 worldPosition() const;
     glm::quat worldRotation() const;
 private:
@@ -174,7 +348,19 @@ public:
     GameObject& gameObject() { return owner_; }
     Transform& transform();
 
+    // Runs the coroutine up to its first co_await; it is stopped with the behaviour. Defined in
+    // Coroutine.cpp: callers include Coroutine.h.
+    CoroutineId StartCoroutine(Coroutine co);
+    void StopCoroutine(CoroutineId id);
+    void StopAllCoroutines() { if (__coroutines) __coroutine_stop_all(this); }
+
     void __set_owner(const GameObject& go) { owner_ = go; }
+
+    // Internal: slot in the per-type dispatch batch; the index stays npos until Start has run
+    ScriptBatch* __batch = nullptr;
+    std::size_t __batch_index = static_cast<std::size_t>(-1);
+    // Internal: live coroutines started by this behaviour
+    std::uint32_t __coroutines = 0;
 protected:
     GameObject owner_{};
 };
@@ -327,6 +513,11 @@ static_assert(
     // Ensure underlying component ids are registered
     extern void ensure_components_registered(ecs_world_t*);
     ensure_components_registered(w);
+    // Adding changes the entity's table: from a job-safe FixedUpdate only the façade comes back
+    const bool forbidden = __job_forbidden("GameObject::AddComponent");
+    auto set = [&](ecs_entity_t component, std::size_t size, const void* value) {
+        if (!forbidden) ecs_set_id(w, (ecs_entity_t)e_, component, size, value);
+    };
 
     if constexpr (std::is_same_v<T, Transform>) {
         // Create or update AmeTransform2D on the entity if missing
@@ -334,14 +525,14 @@ static_assert(
         if (auto* cur = (AmeTransform2D*)ecs_get_id(w, (ecs_entity_t)e_, g_comp.transform)) {
             tr = *cur;
         }
-        ecs_set_id(w, (ecs_entity_t)e_, g_comp.transform, sizeof(AmeTransform2D), &tr);
+        set(g_comp.transform, sizeof(AmeTransform2D), &tr);
         return transform();
     } else if constexpr (std::is_same_v<T, Rigidbody2D>) {
         AmePhysicsBody body = {0};
         if (auto* cur = (AmePhysicsBody*)ecs_get_id(w, (ecs_entity_t)e_, g_comp.body)) {
             body = *cur;
         }
-        ecs_set_id(w, (ecs_entity_t)e_, g_comp.body, sizeof(AmePhysicsBody), &body);
+        set(g_comp.body, sizeof(AmePhysicsBody), &body);
         static thread_local Rigidbody2D rb{ GameObject() };
         rb = Rigidbody2D{ *this };
         return rb;
@@ -356,16 +547,14 @@ static_assert(
         s.sorting_layer = 0;
         s.order_in_layer = 0;
         s.z = 1.0f;
-        s.dirty = 1;
-        ecs_set_id(w, (ecs_entity_t)e_, g_comp.sprite, sizeof(SpriteData), &s);
+        set(g_comp.sprite, sizeof(SpriteData), &s);
         static thread_local SpriteRenderer sr{ GameObject() };
         sr = SpriteRenderer{ *this };
         return sr;
     } else if constexpr (std::is_same_v<T, Material>) {
         MaterialData m{};
         m.r = 1.0f; m.g = 1.0f; m.b = 1.0f; m.a = 1.0f;
-        m.dirty = 1;
-        ecs_set_id(w, (ecs_entity_t)e_, g_comp.material, sizeof(MaterialData), &m);
+        set(g_comp.material, sizeof(MaterialData), &m);
         static thread_local Material mat{ GameObject() };
         mat = Material{ *this };
         return mat;
@@ -378,31 +567,31 @@ static_assert(
         tr.atlas_w = 0; tr.atlas_h = 0;
         tr.tile_w = 0; tr.tile_h = 0;
         tr.firstgid = 0; tr.columns = 0;
-        ecs_set_id(w, (ecs_entity_t)e_, g_comp.tilemap, sizeof(TilemapRefData), &tr);
+        set(g_comp.tilemap, sizeof(TilemapRefData), &tr);
         static thread_local TilemapRenderer t{ GameObject() };
         t = TilemapRenderer{ *this };
         return t;
     } else if constexpr (std::is_same_v<T, MeshRenderer>) {
         struct MeshData { const float* pos; const float* uv; const float* col; std::size_t count; } mr{nullptr,nullptr,nullptr,0};
-        ecs_set_id(w, (ecs_entity_t)e_, g_comp.mesh, sizeof(mr), &mr);
+        set(g_comp.mesh, sizeof(mr), &mr);
         static thread_local MeshRenderer m{ GameObject() };
         m = MeshRenderer{ *this };
         return m;
     } else if constexpr (std::is_same_v<T, Camera>) {
         AmeCamera cam; ame_camera_init(&cam);
-        ecs_set_id(w, (ecs_entity_t)e_, g_comp.camera, sizeof(cam), &cam);
+        set(g_comp.camera, sizeof(cam), &cam);
         static thread_local Camera c{ GameObject() };
         c = Camera{ *this };
         return c;
     } else if constexpr (std::is_same_v<T, TextRenderer>) {
-        struct TextData { const char* text_ptr; std::uint32_t font; float r,g,b,a; float size; int wrap_px; int request_set; char request_buf[256]; } td = { nullptr, 0, 1,1,1,1, 16.0f, 0, 0, {0} };
-        ecs_set_id(w, (ecs_entity_t)e_, g_comp.text, sizeof(td), &td);
+        TextData td = { nullptr, 0, 1,1,1,1, 16.0f, 0 };
+        set(g_comp.text, sizeof(td), &td);
         static thread_local TextRenderer tr{ GameObject() };
         tr = TextRenderer{ *this };
         return tr;
     } else if constexpr (std::is_same_v<T, Collider2D>) {
         struct Col2D { int type; float w,h; float radius; int isTrigger; } cd = {0, 1,1, 0.5f, 0};
-        ecs_set_id(w, (ecs_entity_t)e_, g_comp.collider2d, sizeof(cd), &cd);
+        set(g_comp.collider2d, sizeof(cd), &cd);
         static thread_local Collider2D c2{ GameObject() };
         c2 = Collider2D{ *this };
         return c2;
@@ -505,15 +694,88 @@ T& GameObject::GetComponent() {
     return *p;
 }
 
+// Per-callback override detection. A private or overloaded override makes &T::X ill-formed; such
+// types still get the callback, dispatched virtually.
+#define UNITYLIKE_SCRIPT_CALLBACK_TRAIT(Name, Callback, Sig)                                        \
+    template<typename T, typename = void> struct Name {                                             \
+        static constexpr bool direct = false, overridden = true;                                     \
+    };                                                                                               \
+    template<typename T> struct Name<T, std::void_t<decltype(&T::Callback)>> {                      \
+        static constexpr bool direct = true;                                                         \
+        static constexpr bool overridden = !std::is_same_v<decltype(&T::Callback), Sig>;            \
+    };
+UNITYLIKE_SCRIPT_CALLBACK_TRAIT(ScriptUpdateTrait, Update, void (MongooseBehaviour::*)(float))
+UNITYLIKE_SCRIPT_CALLBACK_TRAIT(ScriptFixedUpdateTrait, FixedUpdate, void (MongooseBehaviour::*)(float))
+UNITYLIKE_SCRIPT_CALLBACK_TRAIT(ScriptLateUpdateTrait, LateUpdate, void (MongooseBehaviour::*)())
+#undef UNITYLIKE_SCRIPT_CALLBACK_TRAIT
+
+// Opt-in to parallel FixedUpdate with `static constexpr bool kJobSafe = true;` in the behaviour.
+// Its FixedUpdate then runs in chunks on the shared worker pool, before the serial scripts. It
+// may only make reads that leave the world unchanged (world transforms come from the values
+// propagated before the dispatch) and write components its own entity owns; a write to one
+// inherited from a prefab is dropped and counted. No Create/Destroy, AddComponent/AddScript,
+// SetParent/SetActive/name, coroutines or physics calls (refused and counted); setters that would
+// add their component are refused too, and TextRenderer::text only queues until the join.
+template<typename T, typename = void> struct ScriptJobSafeTrait { static constexpr bool value = false; };
+template<typename T> struct ScriptJobSafeTrait<T, std::void_t<decltype(T::kJobSafe)>> {
+    static constexpr bool value = T::kJobSafe;
+};
+
+template<typename T>
+void __dispatch_update(MongooseBehaviour* const* s, std::size_t n, float dt) {
+    for (std::size_t i = 0; i < n; ++i) {
+        if (!s[i]) continue;
+        if constexpr (ScriptUpdateTrait<T>::direct) static_cast<T*>(s[i])->T::Update(dt);
+        else s[i]->Update(dt);
+    }
+}
+
+template<typename T>
+void __dispatch_fixed_update(MongooseBehaviour* const* s, std::size_t n, float fdt) {
+    for (std::size_t i = 0; i < n; ++i) {
+        if (!s[i]) continue;
+        if constexpr (ScriptFixedUpdateTrait<T>::direct) static_cast<T*>(s[i])->T::FixedUpdate(fdt);
+        else s[i]->FixedUpdate(fdt);
+    }
+}
+
+template<typename T>
+void __dispatch_late_update(MongooseBehaviour* const* s, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        if (!s[i]) continue;
+        if constexpr (ScriptLateUpdateTrait<T>::direct) static_cast<T*>(s[i])->T::LateUpdate();
+        else s[i]->LateUpdate();
+    }
+}
+
+template<typename T>
+ScriptBatch* __script_batch() {
+    static ScriptBatch* batch = [] {
+        ScriptBatch proto;
+        if (ScriptUpdateTrait<T>::overridden) proto.update = &__dispatch_update<T>;
+        if (ScriptFixedUpdateTrait<T>::overridden) proto.fixed_update = &__dispatch_fixed_update<T>;
+        if (ScriptLateUpdateTrait<T>::overridden) proto.late_update = &__dispatch_late_update<T>;
+        proto.job_safe = ScriptJobSafeTrait<T>::value;
+        return __register_script_batch(proto);
+    }();
+    return batch;
+}
+
 template<typename T, typename... Args>
 T& GameObject::AddScript(Args&&... args) {
     // Ensure host exists (managed outside ECS to avoid moving non-POD types)
     ecs_world_t* w = scene_->world();
+    T* script = new T(std::forward<Args>(args)...);
+    if (__job_forbidden("GameObject::AddScript")) {
+        // Never attached; kept alive for the caller until the jobs have joined
+        __job_discard_script(script);
+        return *script;
+    }
     __ensure_script_host(e_);
     ScriptHost* host = __get_script_host(e_);
-    // Create script and attach
-    T* script = new T(std::forward<Args>(args)...);
+    // Attach
     script->__set_owner(*this);
+    script->__batch = __script_batch<T>();
     host->scripts.push_back(script);
     __register_script_entity(w, e_);
     return *script;
@@ -1,84 +1,283 @@
 #include "Scene.h"
+#include "Coroutine.h"
 #include "TransformHierarchy.h"
+#include "ame/text_system.h"
 #include <flecs.h>
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <memory>
+#include <mutex>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 #include <SDL3/SDL.h>
 
+extern "C" {
+#include "ame/ecs_snapshot.h"
+#include "ame/jobs.h"
+}
+
 namespace unitylike {
 
 // Globals declared in header (remove duplicate definitions)
 // CompIds g_comp{};
 // ecs_entity_t g_comp_script_host = 0;
 
+// Entities whose scripts still need Awake/Start (or were added to an already started host)
 static std::vector<ecs_entity_t> g_script_entities;
 static std::unordered_map<ecs_entity_t, ScriptHost> g_script_hosts;
+// One batch per script type (never freed: __script_batch<T> caches the pointer), and the
+// batches each phase visits
+static std::vector<std::unique_ptr<ScriptBatch>> g_script_batches;
+static std::vector<ScriptBatch*> g_update_batches;
+static std::vector<ScriptBatch*> g_fixed_update_batches;
+static std::vector<ScriptBatch*> g_job_fixed_update_batches;
+static std::vector<ScriptBatch*> g_late_update_batches;
 static bool g_systems_registered = false;
 static float g_current_dt = 0.0f;
 static float g_fixed_dt = 1.0f/60.0f;
 
-// ECS system functions for script execution
-static void ScriptAwakeSystem(ecs_iter_t* it) {
-    // Run Awake for all scripts that haven't been awoken
-    for (ecs_entity_t e : g_script_entities) {
-        ScriptHost* shp = __get_script_host(e);
-        if (!shp) continue;
-        ScriptHost& sh = *shp;
-        if (!sh.awoken) {
-            for (auto* s : sh.scripts) if (s) s->Awake();
-            sh.awoken = true;
-        }
+ScriptBatch* __register_script_batch(const ScriptBatch& proto) {
+    g_script_batches.push_back(std::make_unique<ScriptBatch>(proto));
+    ScriptBatch* b = g_script_batches.back().get();
+    if (b->update) g_update_batches.push_back(b);
+    if (b->fixed_update) (b->job_safe ? g_job_fixed_update_batches : g_fixed_update_batches).push_back(b);
+    if (b->late_update) g_late_update_batches.push_back(b);
+    return b;
+}
+
+static void batch_insert(MongooseBehaviour* s) {
+    ScriptBatch* b = s->__batch;
+    if (!b || s->__batch_index != (std::size_t)-1) return;
+    s->__batch_index = b->scripts.size();
+    b->scripts.push_back(s);
+}
+
+static void batch_remove(MongooseBehaviour* s) {
+    ScriptBatch* b = s->__batch;
+    if (!b || s->__batch_index == (std::size_t)-1) return;
+    b->scripts[s->__batch_index] = nullptr;
+    b->holes++;
+    s->__batch_index = (std::size_t)-1;
+}
+
+static void batch_compact(ScriptBatch* b) {
+    if (!b->holes) return;
+    std::size_t n = 0;
+    for (MongooseBehaviour* s : b->scripts) {
+        if (!s) continue;
+        s->__batch_index = n;
+        b->scripts[n++] = s;
     }
+    b->scripts.resize(n);
+    b->holes = 0;
 }
 
-static void ScriptStartSystem(ecs_iter_t* it) {
-    // Run Start for all scripts that have been awoken but not started
-    for (ecs_entity_t e : g_script_entities) {
-        ScriptHost* shp = __get_script_host(e);
-        if (!shp) continue;
-        ScriptHost& sh = *shp;
-        if (sh.awoken && !sh.started) {
-            for (auto* s : sh.scripts) if (s) s->Start();
-            sh.started = true;
-        }
+// Awake every queued host before any Start (index loop: Awake may add scripts)
+static void run_awake_pass() {
+    for (std::size_t i = 0; i < g_script_entities.size(); ++i) {
+        ScriptHost* sh = __get_script_host(g_script_entities[i]);
+        if (!sh || sh->awoken) continue;
+        sh->awoken = true;
+        for (std::size_t k = 0; k < sh->scripts.size(); ++k) if (sh->scripts[k]) sh->scripts[k]->Awake();
     }
 }
 
-static void ScriptUpdateSystem(ecs_iter_t* it) {
-    // Run Update for all started scripts
-    for (ecs_entity_t e : g_script_entities) {
-        ScriptHost* shp = __get_script_host(e);
-        if (!shp) continue;
-        ScriptHost& sh = *shp;
-        if (sh.started) {
-            for (auto* s : sh.scripts) if (s) s->Update(g_current_dt);
+// Start queued hosts and move their scripts into the dispatch batches; the queue is then empty
+static void run_start_pass() {
+    for (std::size_t i = 0; i < g_script_entities.size(); ++i) {
+        ScriptHost* sh = __get_script_host(g_script_entities[i]);
+        if (!sh) continue;
+        if (!sh->awoken) {
+            sh->awoken = true;
+            for (std::size_t k = 0; k < sh->scripts.size(); ++k) if (sh->scripts[k]) sh->scripts[k]->Awake();
+        }
+        if (!sh->started) {
+            sh->started = true;
+            for (std::size_t k = 0; k < sh->scripts.size(); ++k) if (sh->scripts[k]) sh->scripts[k]->Start();
         }
+        if (sh->dispatched) for (auto* s : sh->scripts) if (s) batch_insert(s);
+        sh->queued = false;
     }
+    g_script_entities.clear();
 }
 
-static void ScriptLateUpdateSystem(ecs_iter_t* it) {
-    // Run LateUpdate for all started scripts
-    for (ecs_entity_t e : g_script_entities) {
-        ScriptHost* shp = __get_script_host(e);
-        if (!shp) continue;
-        ScriptHost& sh = *shp;
-        if (sh.started) {
-            for (auto* s : sh.scripts) if (s) s->LateUpdate();
+static void run_update_batches(float dt) {
+    for (ScriptBatch* b : g_update_batches) {
+        b->update(b->scripts.data(), b->scripts.size(), dt);
+        batch_compact(b);
+    }
+}
+
+// Job-safe FixedUpdate: chunks of one batch each, run on the shared pool once there are enough
+// scripts. Component writes inside are in place only; their modified notifications are recorded
+// per chunk and fired on this thread after the join.
+thread_local bool __t_script_job = false;
+static thread_local ecs_entity_t t_job_entity = 0; // script being checked (safety checks on)
+static thread_local std::vector<std::tuple<ecs_world_t*, ecs_entity_t, ecs_entity_t>>* t_job_touched = nullptr;
+static std::atomic<bool> g_job_checks{false};
+static std::atomic<std::size_t> g_job_violations{0};
+static std::mutex g_job_discarded_mtx;
+static std::vector<MongooseBehaviour*> g_job_discarded; // AddScript refused inside a job
+
+static void job_violation(const char* what, ecs_entity_t e, ecs_entity_t component) {
+    // Log the first few; the count keeps going
+    if (g_job_violations.fetch_add(1, std::memory_order_relaxed) < 16) {
+        SDL_Log("[UnityLike] job-safe FixedUpdate: %s (script entity %llu, target %llu, component %llu)",
+                what, (unsigned long long)t_job_entity, (unsigned long long)e, (unsigned long long)component);
+    }
+}
+
+void* __job_component(ecs_world_t* w, ecs_entity_t e, ecs_entity_t component) {
+    bool checks = g_job_checks.load(std::memory_order_relaxed);
+    if (checks && e != t_job_entity) { job_violation("write to another entity", e, component); return nullptr; }
+    void* p = ecs_get_mut_id(w, e, component);
+    if (p) return p;
+    // Not owned: adding it, or the override of a prefab's shared value, changes the table. The
+    // write is dropped either way; always report it so it is not lost silently.
+    job_violation(ecs_has_id(w, e, component) ? "write to a component inherited from a prefab"
+                                              : "write adds a component", e, component);
+    return nullptr;
+}
+
+void __job_touch(ecs_world_t* w, ecs_entity_t e, ecs_entity_t component) {
+    auto& touched = *t_job_touched;
+    // Scripts write their own entity, so repeats are recent
+    std::size_t n = touched.size(), from = n > 4 ? n - 4 : 0;
+    for (std::size_t i = from; i < n; ++i) {
+        if (touched[i] == std::make_tuple(w, e, component)) return;
+    }
+    touched.emplace_back(w, e, component);
+}
+
+bool __job_forbidden(const char* what) {
+    if (!__t_script_job) return false;
+    job_violation(what, 0, 0);
+    return true;
+}
+
+void __job_discard_script(MongooseBehaviour* script) {
+    std::lock_guard<std::mutex> lock(g_job_discarded_mtx);
+    g_job_discarded.push_back(script);
+}
+
+void Scene::SetJobSafetyChecks(bool on) { g_job_checks.store(on, std::memory_order_relaxed); }
+std::size_t Scene::JobSafetyViolations() { return g_job_violations.load(std::memory_order_relaxed); }
+
+struct FixedUpdateChunk {
+    ScriptBatch* batch;
+    std::size_t first, count;
+    std::vector<std::tuple<ecs_world_t*, ecs_entity_t, ecs_entity_t>> touched;
+};
+
+struct FixedUpdateJob {
+    FixedUpdateChunk* chunks;
+    float fdt;
+    bool checks;
+};
+
+static void fixed_update_chunk(void* ctx, size_t index) {
+    FixedUpdateJob* job = (FixedUpdateJob*)ctx;
+    FixedUpdateChunk& c = job->chunks[index];
+    MongooseBehaviour* const* s = c.batch->scripts.data() + c.first;
+    __t_script_job = true;
+    t_job_touched = &c.touched;
+    if (job->checks) {
+        // One script at a time so writes can be matched to their owner
+        for (std::size_t i = 0; i < c.count; ++i) {
+            if (!s[i]) continue;
+            t_job_entity = (ecs_entity_t)s[i]->gameObject().id();
+            c.batch->fixed_update(s + i, 1, job->fdt);
         }
+        t_job_entity = 0;
+    } else {
+        c.batch->fixed_update(s, c.count, job->fdt);
     }
+    t_job_touched = nullptr;
+    __t_script_job = false;
 }
 
-static void ScriptFixedUpdateSystem(ecs_iter_t* it) {
-    // Run FixedUpdate for all started scripts
-    for (ecs_entity_t e : g_script_entities) {
-        ScriptHost* shp = __get_script_host(e);
-        if (!shp) continue;
-        ScriptHost& sh = *shp;
-        if (sh.started) {
-            for (auto* s : sh.scripts) if (s) s->FixedUpdate(g_fixed_dt);
+static void run_job_fixed_update_batches(ecs_world_t* w, float fdt) {
+    constexpr std::size_t kChunkScripts = 64;
+    constexpr std::size_t kParallelScripts = 256;
+    static std::vector<FixedUpdateChunk> chunks;
+    std::size_t n = 0, total = 0;
+    for (ScriptBatch* b : g_job_fixed_update_batches) {
+        for (std::size_t first = 0; first < b->scripts.size(); first += kChunkScripts) {
+            if (n == chunks.size()) chunks.emplace_back();
+            FixedUpdateChunk& c = chunks[n++];
+            c.batch = b;
+            c.first = first;
+            c.count = std::min(kChunkScripts, b->scripts.size() - first);
+            c.touched.clear();
+        }
+        total += b->scripts.size();
+    }
+    if (n == 0) return;
+    // Propagate world transforms once up front; inside the jobs ameGetWorldTransform only reads
+    ameUpdateWorldTransforms(w);
+    FixedUpdateJob job{ chunks.data(), fdt, g_job_checks.load(std::memory_order_relaxed) };
+    ame_jobs_parallel_for(total >= kParallelScripts ? ame_jobs_shared() : nullptr, n, fixed_update_chunk, &job);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        for (const auto& t : chunks[i].touched) {
+            ecs_world_t* tw = std::get<0>(t);
+            ecs_entity_t e = std::get<1>(t), id = std::get<2>(t);
+            EditScope* scope = __current_edit_scope();
+            if (scope && scope->world() == tw) scope->touch(e, id);
+            else if (ecs_is_alive(tw, e) && ecs_has_id(tw, e, id)) ecs_modified_id(tw, e, id);
         }
     }
+    // TextRenderer::text only queues from a job; the strings land here, on the logic thread
+    if (!ecs_is_deferred(w)) ame_text_apply_requests(w);
+    for (MongooseBehaviour* s : g_job_discarded) delete s;
+    g_job_discarded.clear();
+    for (ScriptBatch* b : g_job_fixed_update_batches) batch_compact(b);
+}
+
+static void run_fixed_update_batches(ecs_world_t* w, float fdt) {
+    if (!g_job_fixed_update_batches.empty()) run_job_fixed_update_batches(w, fdt);
+    for (ScriptBatch* b : g_fixed_update_batches) {
+        b->fixed_update(b->scripts.data(), b->scripts.size(), fdt);
+        batch_compact(b);
+    }
+}
+
+static void run_late_update_batches() {
+    for (ScriptBatch* b : g_late_update_batches) {
+        b->late_update(b->scripts.data(), b->scripts.size());
+        batch_compact(b);
+    }
+}
+
+// ECS system functions for script execution
+static void ScriptAwakeSystem(ecs_iter_t* it) {
+    (void)it;
+    run_awake_pass();
+}
+
+static void ScriptStartSystem(ecs_iter_t* it) {
+    (void)it;
+    run_start_pass();
+}
+
+// Coroutines waiting on time, frames or events resume after the Update batches; both see the
+// pipeline's delta_time
+static void ScriptUpdateSystem(ecs_iter_t* it) {
+    g_current_dt = it->delta_time;
+    run_update_batches(g_current_dt);
+    __coroutines_update(g_current_dt);
+}
+
+static void ScriptLateUpdateSystem(ecs_iter_t* it) {
+    (void)it;
+    run_late_update_batches();
+}
+
+static void ScriptFixedUpdateSystem(ecs_iter_t* it) {
+    run_fixed_update_batches(it->world, g_fixed_dt);
+    __coroutines_fixed_update();
 }
 
 // Register the script systems with appropriate ECS phases
@@ -136,9 +335,10 @@ static void register_script_systems(ecs_world_t* world) {
 }
 
 void __register_script_entity(ecs_world_t* /*w*/, std::uint64_t e) {
-    ecs_entity_t ee = (ecs_entity_t)e;
-    for (auto id : g_script_entities) { if (id == ee) return; }
-    g_script_entities.push_back(ee);
+    ScriptHost* sh = __get_script_host(e);
+    if (!sh || sh->queued) return;
+    sh->queued = true;
+    g_script_entities.push_back((ecs_entity_t)e);
 }
 
 ScriptHost* __get_script_host(std::uint64_t e){
@@ -154,15 +354,31 @@ void __remove_script_host(std::uint64_t e){
     auto ee = (ecs_entity_t)e;
     g_script_hosts.erase(ee);
 }
+// Hosts still waiting for Start are left alone; the start pass inserts their scripts
+void __set_scripts_dispatched(std::uint64_t e, bool dispatched) {
+    ScriptHost* sh = __get_script_host(e);
+    if (!sh) return;
+    sh->dispatched = dispatched;
+    if (!sh->started) return; // the start pass reads `dispatched`
+    for (auto* s : sh->scripts) {
+        if (!s) continue;
+        if (dispatched) { batch_insert(s); continue; }
+        s->StopAllCoroutines();
+        batch_remove(s);
+    }
+}
 
 // Scene core
 Scene::Scene(ecs_world_t* world) : world_(world) {
     assert(world_ != nullptr);
     ensure_components_registered(world_);
     register_script_systems(world_);
+    ameRegisterTransformSystems(world_);
 }
 
 Scene::~Scene() {
+    // Coroutine frames first: they may hold locals that refer to their scripts
+    __coroutines_clear();
     // Cleanup: delete all scripts from all hosts to avoid leaks
     for (auto& kv : g_script_hosts) {
         ScriptHost& sh = kv.second;
@@ -173,9 +389,35 @@ Scene::~Scene() {
     }
     g_script_hosts.clear();
     g_script_entities.clear();
+    for (auto& b : g_script_batches) { b->scripts.clear(); b->holes = 0; }
+    for (AmeSnapshotFile* f : snapshots_) ame_snapshot_file_close(f);
+}
+
+static thread_local EditScope* t_edit_scope = nullptr;
+
+EditScope* __current_edit_scope() { return t_edit_scope; }
+
+EditScope::EditScope(Scene& scene) : world_(scene.world()), prev_(t_edit_scope) {
+    t_edit_scope = this;
+}
+
+EditScope::~EditScope() {
+    t_edit_scope = prev_;
+    for (const auto& t : touched_) {
+        if (ecs_is_alive(world_, t.first) && ecs_has_id(world_, t.first, t.second)) ecs_modified_id(world_, t.first, t.second);
+    }
+}
+
+// Few distinct components per scope; a linear scan beats hashing
+void EditScope::touch(ecs_entity_t e, ecs_entity_t component) {
+    for (const auto& t : touched_) {
+        if (t.first == e && t.second == component) return;
+    }
+    touched_.emplace_back(e, component);
 }
 
 GameObject Scene::Create(const std::string& name) {
+    if (__job_forbidden("Scene::Create")) return GameObject();
     ensure_components_registered(world_);
     ecs_entity_desc_t ed = {0};
     if (!name.empty()) ed.name = name.c_str();
@@ -185,11 +427,55 @@ GameObject Scene::Create(const std::string& name) {
     return go;
 }
 
+GameObject Scene::CreatePrefab(const std::string& name) {
+    GameObject go = Create(name);
+    if (go.id()) ecs_add_id(world_, (ecs_entity_t)go.id(), EcsPrefab);
+    return go;
+}
+
+GameObject Scene::Instantiate(const GameObject& prefab) {
+    if (!prefab.id() || __job_forbidden("Scene::Instantiate")) return GameObject();
+    ensure_components_registered(world_);
+    ecs_entity_t e = ecs_new_w_pair(world_, EcsIsA, (ecs_entity_t)prefab.id());
+    return GameObject(this, (GameObject::Entity)e);
+}
+
+std::vector<GameObject> Scene::CreateBulk(std::size_t count, const BulkSpawn& spawn) {
+    std::vector<GameObject> out;
+    if (count == 0 || count > (std::size_t)INT32_MAX) return out;
+    ensure_components_registered(world_);
+    ecs_bulk_desc_t bd = {};
+    void* data[sizeof(bd.ids) / sizeof(bd.ids[0])] = {};
+    int n = 0;
+    auto add = [&](ecs_entity_t id, const void* values) {
+        if (!values) return;
+        bd.ids[n] = id;
+        data[n] = const_cast<void*>(values);
+        n++;
+    };
+    add(g_comp.transform, spawn.transforms);
+    add(g_comp.scale2d, spawn.scales);
+    add(g_comp.sprite, spawn.sprites);
+    add(g_comp.material, spawn.materials);
+    add(g_comp.collider2d, spawn.colliders);
+    add(g_comp.body, spawn.bodies);
+    // Same archetype the With trait gives one-by-one creation; propagation fills the values
+    if (spawn.transforms) bd.ids[n++] = g_comp.world_transform;
+    if (spawn.prefab) bd.ids[n++] = ecs_pair(EcsIsA, (ecs_entity_t)spawn.prefab);
+    bd.count = (int32_t)count;
+    bd.data = data;
+    const ecs_entity_t* ents = ecs_bulk_init(world_, &bd);
+    if (!ents) return out;
+    out.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) out.emplace_back(this, (GameObject::Entity)ents[i]);
+    return out;
+}
+
 void Scene::Destroy(GameObject& go) {
-    if (!go.id()) return;
+    if (!go.id() || __job_forbidden("Scene::Destroy")) return;
     ScriptHost* host = __get_script_host(go.id());
     if (host) {
-        for (auto* s : host->scripts) { if (s) { s->OnDestroy(); delete s; } }
+        for (auto* s : host->scripts) { if (s) { s->OnDestroy(); s->StopAllCoroutines(); batch_remove(s); delete s; } }
         host->scripts.clear();
         __remove_script_host(go.id());
     }
@@ -210,47 +496,19 @@ void Scene::Step(float dt) {
     ensure_components_registered(world_);
     unitylike_begin_update(dt);
 
-    // Pass 1: Awake all scripts on all entities before any Start
-    for (ecs_entity_t e : g_script_entities) {
-        ScriptHost* shp = __get_script_host(e);
-        if (!shp) continue;
-        ScriptHost& sh = *shp;
-        if (!sh.awoken) {
-            for (auto* s : sh.scripts) if (s) s->Awake();
-            sh.awoken = true;
-        }
-    }
-
-    // Pass 2: Start all scripts on all entities after Awake pass
-    for (ecs_entity_t e : g_script_entities) {
-        ScriptHost* shp = __get_script_host(e);
-        if (!shp) continue;
-        ScriptHost& sh = *shp;
-        if (!sh.started) {
-            for (auto* s : sh.scripts) if (s) s->Start();
-            sh.started = true;
-        }
-    }
-
-    // Pass 3: Regular Update and LateUpdate
-    for (ecs_entity_t e : g_script_entities) {
-        ScriptHost* shp = __get_script_host(e);
-        if (!shp) continue;
-        ScriptHost& sh = *shp;
-        for (auto* s : sh.scripts) if (s) s->Update(dt);
-        for (auto* s : sh.scripts) if (s) s->LateUpdate();
-    }
+    // Awake everything queued before any Start, then per-type Update and LateUpdate batches
+    run_awake_pass();
+    run_start_pass();
+    run_update_batches(dt);
+    __coroutines_update(dt);
+    run_late_update_batches();
 }
 
 void Scene::StepFixed(float fdt) {
     ensure_components_registered(world_);
     unitylike_set_fixed_dt(fdt);
-    for (ecs_entity_t e : g_script_entities) {
-        ScriptHost* shp = __get_script_host(e);
-        if (!shp) continue;
-        ScriptHost& sh = *shp;
-        for (auto* s : sh.scripts) if (s) s->FixedUpdate(fdt);
-    }
+    run_fixed_update_batches(world_, fdt);
+    __coroutines_fixed_update();
 }
 
 // GameObject basics
@@ -261,7 +519,7 @@ bool GameObject::activeSelf() const {
 }
 
 void GameObject::SetActive(bool v) {
-    if (!scene_ || !e_) return;
+    if (!scene_ || !e_ || __job_forbidden("GameObject::SetActive")) return;
     ecs_world_t* w = scene_->world();
     if (v) ecs_remove_id(w, (ecs_entity_t)e_, EcsDisabled);
     else ecs_add_id(w, (ecs_entity_t)e_, EcsDisabled);
@@ -276,6 +534,7 @@ const std::string& GameObject::name() const {
 }
 
 void GameObject::name(const std::string& n) {
+    if (__job_forbidden("GameObject::name")) return;
     name_cache_ = n;
     if (!scene_ || !e_) return;
     ecs_set_name(scene_->world(), (ecs_entity_t)e_, n.c_str());
@@ -294,7 +553,7 @@ bool GameObject::IsValid() const {
 }
 
 void GameObject::SetParent(const GameObject& parent, bool keepWorld) {
-    if (!scene_ || !e_) return;
+    if (!scene_ || !e_ || __job_forbidden("GameObject::SetParent")) return;
     ecs_world_t* w = scene_->world();
     if (parent.scene() && parent.scene() != scene_) {
         // Cross-scene parenting not supported
@@ -323,7 +582,7 @@ void GameObject::SetParent(const GameObject& parent, bool keepWorld) {
     }
     // Compute world before change using helper
     auto compute_world = [&](ecs_entity_t ent){
-        AmeWorldTransform2D wt = ameComputeWorldTransform(w, ent);
+        AmeWorldTransform2D wt = ameGetWorldTransform(w, ent);
         return std::tuple<float,float,float>(wt.x, wt.y, wt.angle);
     };
     float cw_x=0, cw_y=0, cw_a=0;
@@ -0,0 +1,143 @@
+#include "Scene.h"
+#include <cstring>
+
+extern "C" {
+#include "ame/ecs_snapshot.h"
+}
+#include "ame/text_system.h"
+
+namespace unitylike {
+
+namespace {
+
+enum : std::uint32_t { MESH_POS = 1u, MESH_UV = 2u, MESH_COL = 4u };
+
+// Per row: u64 vertex count, u32 array flags, u32 pad, then pos (2 floats), uv (2), col (4) per vertex
+bool save_mesh(const void* values, std::int32_t count, AmeSnapshotWriter* out, void*) {
+    const MeshData* m = static_cast<const MeshData*>(values);
+    for (std::int32_t i = 0; i < count; ++i) {
+        std::uint64_t n = m[i].count;
+        std::uint32_t flags = (m[i].pos ? MESH_POS : 0u) | (m[i].uv ? MESH_UV : 0u) | (m[i].col ? MESH_COL : 0u);
+        std::uint32_t pad = 0;
+        if (!ame_snapshot_write(out, &n, sizeof n) || !ame_snapshot_write(out, &flags, sizeof flags) ||
+            !ame_snapshot_write(out, &pad, sizeof pad)) return false;
+        if (m[i].pos && !ame_snapshot_write(out, m[i].pos, n * 2 * sizeof(float))) return false;
+        if (m[i].uv && !ame_snapshot_write(out, m[i].uv, n * 2 * sizeof(float))) return false;
+        if (m[i].col && !ame_snapshot_write(out, m[i].col, n * 4 * sizeof(float))) return false;
+    }
+    return true;
+}
+
+// Vertex arrays point into the mapped snapshot (no copy); the Scene keeps the file open
+bool load_mesh(void* values, std::int32_t count, const std::uint8_t* data, std::size_t size, void*) {
+    MeshData* m = static_cast<MeshData*>(values);
+    std::size_t pos = 0;
+    auto take = [&](std::size_t bytes) -> const std::uint8_t* {
+        if (bytes > size - pos) return nullptr;
+        const std::uint8_t* p = data + pos;
+        pos += bytes;
+        return p;
+    };
+    for (std::int32_t i = 0; i < count; ++i) {
+        const std::uint8_t* head = take(16);
+        if (!head) return false;
+        std::uint64_t n; std::uint32_t flags;
+        std::memcpy(&n, head, sizeof n);
+        std::memcpy(&flags, head + 8, sizeof flags);
+        if (n > size / sizeof(float)) return false;
+        m[i].count = (std::size_t)n;
+        if (flags & MESH_POS) { m[i].pos = reinterpret_cast<const float*>(take(n * 2 * sizeof(float))); if (!m[i].pos) return false; }
+        if (flags & MESH_UV)  { m[i].uv  = reinterpret_cast<const float*>(take(n * 2 * sizeof(float))); if (!m[i].uv) return false; }
+        if (flags & MESH_COL) { m[i].col = reinterpret_cast<const float*>(take(n * 4 * sizeof(float))); if (!m[i].col) return false; }
+    }
+    return true;
+}
+
+// Per row: the TextData bytes with text_ptr cleared, u32 length, chars
+bool save_text(const void* values, std::int32_t count, AmeSnapshotWriter* out, void*) {
+    const TextData* t = static_cast<const TextData*>(values);
+    for (std::int32_t i = 0; i < count; ++i) {
+        TextData row = t[i];
+        row.text_ptr = nullptr;
+        std::uint32_t len = t[i].text_ptr ? (std::uint32_t)std::strlen(t[i].text_ptr) : 0u;
+        if (!ame_snapshot_write(out, &row, sizeof row) || !ame_snapshot_write(out, &len, sizeof len) ||
+            !ame_snapshot_write(out, t[i].text_ptr, len)) return false;
+    }
+    return true;
+}
+
+// Strings stored for rows that never reach the world go back to the arena
+void discard_text(void* values, std::int32_t count, void* user) {
+    ecs_world_t* w = static_cast<ecs_world_t*>(user);
+    TextData* t = static_cast<TextData*>(values);
+    for (std::int32_t i = 0; i < count; ++i) {
+        ame_text_release(w, t[i].text_ptr);
+        t[i].text_ptr = nullptr;
+    }
+}
+
+// text_ptr belongs to the world's text arena (see text_system.c), so strings are copied into it
+bool load_text(void* values, std::int32_t count, const std::uint8_t* data, std::size_t size, void* user) {
+    ecs_world_t* w = static_cast<ecs_world_t*>(user);
+    TextData* t = static_cast<TextData*>(values);
+    std::size_t pos = 0;
+    for (std::int32_t i = 0; i < count; ++i) {
+        std::uint32_t len;
+        bool ok = sizeof(TextData) + sizeof len <= size - pos;
+        if (ok) {
+            std::memcpy(&t[i], data + pos, sizeof(TextData));
+            std::memcpy(&len, data + pos + sizeof(TextData), sizeof len);
+            pos += sizeof(TextData) + sizeof len;
+            t[i].text_ptr = nullptr;
+            ok = len <= size - pos;
+        }
+        if (ok && len) {
+            t[i].text_ptr = ame_text_store(w, reinterpret_cast<const char*>(data + pos), len);
+            ok = t[i].text_ptr != nullptr;
+            pos += len;
+        }
+        if (!ok) { discard_text(values, i, user); return false; }
+    }
+    return true;
+}
+
+// Façade components that survive a save; bodies and tilemaps hold runtime handles and are rebuilt
+AmeSnapshotSchema* make_schema(ecs_world_t* w) {
+    static const AmeSnapshotSerializer mesh = { save_mesh, load_mesh, nullptr };
+    const AmeSnapshotSerializer text = { save_text, load_text, w, discard_text };
+    AmeSnapshotSchema* s = ame_snapshot_schema_create();
+    if (!s) return nullptr;
+    ame_snapshot_schema_add(s, w, g_comp.transform, nullptr);
+    ame_snapshot_schema_add(s, w, g_comp.scale2d, nullptr);
+    ame_snapshot_schema_add(s, w, g_comp.sprite, nullptr);
+    ame_snapshot_schema_add(s, w, g_comp.material, nullptr);
+    ame_snapshot_schema_add(s, w, g_comp.camera, nullptr);
+    ame_snapshot_schema_add(s, w, g_comp.collider2d, nullptr);
+    ame_snapshot_schema_add(s, w, g_comp.mesh, &mesh);
+    ame_snapshot_schema_add(s, w, g_comp.text, &text);
+    return s;
+}
+
+} // namespace
+
+bool Scene::SaveSnapshot(const std::string& path) {
+    ensure_components_registered(world_);
+    AmeSnapshotSchema* schema = make_schema(world_);
+    if (!schema) return false;
+    bool ok = ame_snapshot_save(world_, schema, path.c_str());
+    ame_snapshot_schema_destroy(schema);
+    return ok;
+}
+
+bool Scene::LoadSnapshot(const std::string& path) {
+    ensure_components_registered(world_);
+    AmeSnapshotSchema* schema = make_schema(world_);
+    if (!schema) return false;
+    AmeSnapshotFile* file = ame_snapshot_load(world_, schema, path.c_str(), nullptr);
+    ame_snapshot_schema_destroy(schema);
+    if (!file) return false;
+    snapshots_.push_back(file);
+    return true;
+}
+
+} // namespace unitylike
@@ -1,13 +1,11 @@
 #include "Scene.h"
-#include <cstring>
 
 namespace unitylike {
 
 void SpriteRenderer::texture(std::uint32_t tex) {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
-    SpriteData s{0}; if (auto* cur=(SpriteData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.sprite)) s=*cur;
-    s.tex = tex; s.dirty = 1;
-    ecs_set_id(w, (ecs_entity_t)owner_.id(), g_comp.sprite, sizeof s, &s);
+    ComponentEdit<SpriteData> s(w, owner_.id(), g_comp.sprite);
+    if (s) { s->tex = tex; }
 }
 std::uint32_t SpriteRenderer::texture() const {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
@@ -16,9 +14,8 @@ std::uint32_t SpriteRenderer::texture() const {
 }
 void SpriteRenderer::size(const glm::vec2& s2) {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
-    SpriteData s{0}; if (auto* cur=(SpriteData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.sprite)) s=*cur;
-    s.w = s2.x; s.h = s2.y; s.dirty = 1;
-    ecs_set_id(w, (ecs_entity_t)owner_.id(), g_comp.sprite, sizeof s, &s);
+    ComponentEdit<SpriteData> s(w, owner_.id(), g_comp.sprite);
+    if (s) { s->w = s2.x; s->h = s2.y; }
 }
 glm::vec2 SpriteRenderer::size() const {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
@@ -27,9 +24,8 @@ glm::vec2 SpriteRenderer::size() const {
 }
 void SpriteRenderer::uv(float u0, float v0, float u1, float v1) {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
-    SpriteData s{0}; if (auto* cur=(SpriteData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.sprite)) s=*cur;
-    s.u0=u0; s.v0=v0; s.u1=u1; s.v1=v1; s.dirty = 1;
-    ecs_set_id(w, (ecs_entity_t)owner_.id(), g_comp.sprite, sizeof s, &s);
+    ComponentEdit<SpriteData> s(w, owner_.id(), g_comp.sprite);
+    if (s) { s->u0=u0; s->v0=v0; s->u1=u1; s->v1=v1; }
 }
 glm::vec4 SpriteRenderer::uv() const {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
@@ -38,9 +34,8 @@ glm::vec4 SpriteRenderer::uv() const {
 }
 void SpriteRenderer::color(const glm::vec4& c) {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
-    SpriteData s{0}; if (auto* cur=(SpriteData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.sprite)) s=*cur;
-    s.r=c.r; s.g=c.g; s.b=c.b; s.a=c.a; s.dirty = 1;
-    ecs_set_id(w, (ecs_entity_t)owner_.id(), g_comp.sprite, sizeof s, &s);
+    ComponentEdit<SpriteData> s(w, owner_.id(), g_comp.sprite);
+    if (s) { s->r=c.r; s->g=c.g; s->b=c.b; s->a=c.a; }
 }
 glm::vec4 SpriteRenderer::color() const {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
@@ -49,9 +44,8 @@ glm::vec4 SpriteRenderer::color() const {
 }
 void SpriteRenderer::enabled(bool v) {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
-    SpriteData s{0}; if (auto* cur=(SpriteData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.sprite)) s=*cur;
-    s.visible = v ? 1 : 0; s.dirty = 1;
-    ecs_set_id(w, (ecs_entity_t)owner_.id(), g_comp.sprite, sizeof s, &s);
+    ComponentEdit<SpriteData> s(w, owner_.id(), g_comp.sprite);
+    if (s) { s->visible = v ? 1 : 0; }
 }
 bool SpriteRenderer::enabled() const {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
@@ -59,10 +53,10 @@ bool SpriteRenderer::enabled() const {
     return true;
 }
 int SpriteRenderer::sortingLayer() const { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); if (auto* s=(SpriteData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.sprite)) return s->sorting_layer; return 0; }
-void SpriteRenderer::sortingLayer(int l) { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); SpriteData s{0}; if (auto* cur=(SpriteData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.sprite)) s=*cur; s.sorting_layer=l; s.dirty=1; ecs_set_id(w,(ecs_entity_t)owner_.id(), g_comp.sprite, sizeof s, &s);} 
+void SpriteRenderer::sortingLayer(int l) { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); ComponentEdit<SpriteData> s(w, owner_.id(), g_comp.sprite); if (s) s->sorting_layer=l; } 
 int SpriteRenderer::orderInLayer() const { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); if (auto* s=(SpriteData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.sprite)) return s->order_in_layer; return 0; }
-void SpriteRenderer::orderInLayer(int o) { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); SpriteData s{0}; if (auto* cur=(SpriteData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.sprite)) s=*cur; s.order_in_layer=o; s.dirty=1; ecs_set_id(w,(ecs_entity_t)owner_.id(), g_comp.sprite, sizeof s, &s);} 
+void SpriteRenderer::orderInLayer(int o) { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); ComponentEdit<SpriteData> s(w, owner_.id(), g_comp.sprite); if (s) s->order_in_layer=o; } 
 float SpriteRenderer::z() const { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); if (auto* s=(SpriteData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.sprite)) return s->z; return 0.0f; }
-void SpriteRenderer::z(float zv) { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); SpriteData s{0}; if (auto* cur=(SpriteData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.sprite)) s=*cur; s.z=zv; s.dirty=1; ecs_set_id(w,(ecs_entity_t)owner_.id(), g_comp.sprite, sizeof s, &s);} 
+void SpriteRenderer::z(float zv) { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); ComponentEdit<SpriteData> s(w, owner_.id(), g_comp.sprite); if (s) s->z=zv; } 
 
 } // namespace unitylike
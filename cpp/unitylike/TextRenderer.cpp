@@ -1,36 +1,36 @@
 #include "Scene.h"
-#include <cstring>
+#include "ame/text_system.h"
 
 namespace unitylike {
 
+// Queued in the text arena; applied right away outside systems, else by SysTextApplyRequests.
+// From a job-safe FixedUpdate it is only queued (applied after the join) and needs the Text.
 void TextRenderer::text(const std::string& s) {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
-    TextData td{}; if (auto* cur=(TextData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.text)) td=*cur;
-    size_t n = s.size(); if (n > sizeof(td.request_buf)-1) n = sizeof(td.request_buf)-1;
-    std::memcpy(td.request_buf, s.data(), n); td.request_buf[n] = '\0';
-    td.request_set = 1;
-    ecs_set_id(w, (ecs_entity_t)owner_.id(), g_comp.text, sizeof td, &td);
+    ecs_entity_t e = (ecs_entity_t)owner_.id();
+    if (!ecs_has_id(w, e, g_comp.text)) {
+        if (__job_forbidden("TextRenderer::text adds Text")) return;
+        TextData td{}; ecs_set_id(w, e, g_comp.text, sizeof td, &td);
+    }
+    if (!ame_text_request(w, e, s.data(), s.size())) return;
+    if (!__t_script_job && !ecs_is_deferred(w)) ame_text_apply_requests(w);
 }
 std::string TextRenderer::text() const {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
     if (auto* td = (TextData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.text)) {
         if (td->text_ptr) return std::string(td->text_ptr);
-        if (td->request_set) return std::string(td->request_buf);
     }
     return std::string();
 }
-void TextRenderer::color(const glm::vec4& c) {
-    ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
-    TextData td{}; if (auto* cur=(TextData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.text)) td=*cur;
-    td.r=c.r; td.g=c.g; td.b=c.b; td.a=c.a;
-    ecs_set_id(w, (ecs_entity_t)owner_.id(), g_comp.text, sizeof td, &td);
-}
+// Setters edit in place: a whole TextData copied through ecs_set_id could carry a text_ptr the
+// arena has released by the time a deferred set is applied
+void TextRenderer::color(const glm::vec4& c) { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); ComponentEdit<TextData> td(w, owner_.id(), g_comp.text); if (td) { td->r=c.r; td->g=c.g; td->b=c.b; td->a=c.a; } }
 glm::vec4 TextRenderer::color() const { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); if (auto* td=(TextData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.text)) return glm::vec4(td->r,td->g,td->b,td->a); return glm::vec4(1.0f); }
-void TextRenderer::font(std::uint32_t id) { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); TextData td{}; if (auto* cur=(TextData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.text)) td=*cur; td.font=id; ecs_set_id(w,(ecs_entity_t)owner_.id(), g_comp.text, sizeof td, &td);} 
+void TextRenderer::font(std::uint32_t id) { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); ComponentEdit<TextData> td(w, owner_.id(), g_comp.text); if (td) td->font=id; }
 std::uint32_t TextRenderer::font() const { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); if (auto* td=(TextData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.text)) return td->font; return 0; }
-void TextRenderer::size(float px) { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); TextData td{}; if (auto* cur=(TextData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.text)) td=*cur; td.size=px; ecs_set_id(w,(ecs_entity_t)owner_.id(), g_comp.text, sizeof td, &td);} 
+void TextRenderer::size(float px) { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); ComponentEdit<TextData> td(w, owner_.id(), g_comp.text); if (td) td->size=px; }
 float TextRenderer::size() const { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); if (auto* td=(TextData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.text)) return td->size; return 16.0f; }
-void TextRenderer::wrapWidth(int px) { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); TextData td{}; if (auto* cur=(TextData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.text)) td=*cur; td.wrap_px=px; ecs_set_id(w,(ecs_entity_t)owner_.id(), g_comp.text, sizeof td, &td);} 
+void TextRenderer::wrapWidth(int px) { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); ComponentEdit<TextData> td(w, owner_.id(), g_comp.text); if (td) td->wrap_px=px; }
 int TextRenderer::wrapWidth() const { ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w); if (auto* td=(TextData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.text)) return td->wrap_px; return 0; }
 
 } // namespace unitylike
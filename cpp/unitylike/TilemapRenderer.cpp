@@ -4,9 +4,8 @@ namespace unitylike {
 
 void TilemapRenderer::map(AmeTilemap* m) {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
-    TilemapRefData t{nullptr,0}; if (auto* cur=(TilemapRefData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.tilemap)) t=*cur;
-    t.map = m;
-    ecs_set_id(w, (ecs_entity_t)owner_.id(), g_comp.tilemap, sizeof t, &t);
+    ComponentEdit<TilemapRefData> t(w, owner_.id(), g_comp.tilemap);
+    if (t) t->map = m;
 }
 AmeTilemap* TilemapRenderer::map() const {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
@@ -15,9 +14,8 @@ AmeTilemap* TilemapRenderer::map() const {
 }
 void TilemapRenderer::layer(int idx) {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
-    TilemapRefData t{nullptr,0}; if (auto* cur=(TilemapRefData*)ecs_get_id(w,(ecs_entity_t)owner_.id(), g_comp.tilemap)) t=*cur;
-    t.layer = idx;
-    ecs_set_id(w, (ecs_entity_t)owner_.id(), g_comp.tilemap, sizeof t, &t);
+    ComponentEdit<TilemapRefData> t(w, owner_.id(), g_comp.tilemap);
+    if (t) t->layer = idx;
 }
 int TilemapRenderer::layer() const {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
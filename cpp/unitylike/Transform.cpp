@@ -14,11 +14,8 @@ glm::vec3 Transform::position() const {
 void Transform::position(const glm::vec3& p) {
     ecs_world_t* w = owner_.scene()->world();
     ensure_components_registered(w);
-    AmeTransform2D tr = { (float)p.x, (float)p.y, 0.0f };
-    if (AmeTransform2D* cur = (AmeTransform2D*)ecs_get_id(w, (ecs_entity_t)owner_.id(), g_comp.transform)) {
-        tr.angle = cur->angle;
-    }
-    ecs_set_id(w, (ecs_entity_t)owner_.id(), g_comp.transform, sizeof(AmeTransform2D), &tr);
+    ComponentEdit<AmeTransform2D> tr(w, owner_.id(), g_comp.transform);
+    if (tr) { tr->x = (float)p.x; tr->y = (float)p.y; }
 }
 
 glm::quat Transform::rotation() const {
@@ -32,9 +29,8 @@ void Transform::rotation(const glm::quat& q) {
     // crude 2D angle extraction
     float a = 2.0f * std::atan2(std::sqrt(q.z*q.z + q.w*q.w) - q.w, q.z);
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
-    AmeTransform2D tr = { 0.0f, 0.0f, a };
-    if (AmeTransform2D* cur = (AmeTransform2D*)ecs_get_id(w, (ecs_entity_t)owner_.id(), g_comp.transform)) { tr.x = cur->x; tr.y = cur->y; }
-    ecs_set_id(w, (ecs_entity_t)owner_.id(), g_comp.transform, sizeof(AmeTransform2D), &tr);
+    ComponentEdit<AmeTransform2D> tr(w, owner_.id(), g_comp.transform);
+    if (tr) tr->angle = a;
 }
 
 glm::vec3 Transform::localScale() const {
@@ -46,20 +42,20 @@ glm::vec3 Transform::localScale() const {
 
 void Transform::localScale(const glm::vec3& s) {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
-    Scale2D val{ (float)s.x, (float)s.y };
-    ecs_set_id(w, (ecs_entity_t)owner_.id(), g_comp.scale2d, sizeof(Scale2D), &val);
+    ComponentEdit<Scale2D> sc(w, owner_.id(), g_comp.scale2d);
+    if (sc) { sc->sx = (float)s.x; sc->sy = (float)s.y; }
 }
 
-// Compose world position by traversing EcsChildOf chain and accumulating transforms
+// World pose from the cached WorldTransform2D (propagated on demand when stale)
 glm::vec3 Transform::worldPosition() const {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
-    AmeWorldTransform2D wt = ameComputeWorldTransform(w, (ecs_entity_t)owner_.id());
+    AmeWorldTransform2D wt = ameGetWorldTransform(w, (ecs_entity_t)owner_.id());
     return glm::vec3(wt.x, wt.y, 0.0f);
 }
 
 glm::quat Transform::worldRotation() const {
     ecs_world_t* w = owner_.scene()->world(); ensure_components_registered(w);
-    AmeWorldTransform2D wt = ameComputeWorldTransform(w, (ecs_entity_t)owner_.id());
+    AmeWorldTransform2D wt = ameGetWorldTransform(w, (ecs_entity_t)owner_.id());
     return glm::quat(glm::vec3(0.0f, 0.0f, wt.angle));
 }
 
@@ -1,5 +1,6 @@
 #include "TransformHierarchy.h"
 #include "Scene.h"
+#include <unordered_map>
 
 namespace unitylike {
 
@@ -40,5 +41,102 @@ AmeWorldTransform2D ameComputeWorldTransform(ecs_world_t* world, ecs_entity_t e)
     return out;
 }
 
+// Propagation query per world; queries are entities and die with their world
+static std::unordered_map<ecs_world_t*, ecs_query_t*> g_wt_queries;
+
+static void wt_query_forget(ecs_world_t* world, void* ctx) {
+    (void)ctx;
+    g_wt_queries.erase(world);
+}
+
+static ecs_query_t* wt_query(ecs_world_t* world) {
+    auto found = g_wt_queries.find(world);
+    if (found != g_wt_queries.end()) return found->second;
+    ensure_components_registered(world);
+    ecs_query_desc_t d = {};
+    d.cache_kind = EcsQueryCacheAuto;
+#ifdef EcsQueryDetectChanges
+    d.flags |= EcsQueryDetectChanges;
+#endif
+    d.terms[0].id = g_comp.transform;       d.terms[0].inout = EcsIn;
+    d.terms[1].id = g_comp.scale2d;         d.terms[1].inout = EcsIn;  d.terms[1].oper = EcsOptional;
+    d.terms[2].id = g_comp.world_transform; d.terms[2].inout = EcsOut;
+    // Parent's world transform; cascade orders tables by depth so parents are written first
+    d.terms[3].id = g_comp.world_transform; d.terms[3].inout = EcsIn;  d.terms[3].oper = EcsOptional;
+    d.terms[3].src.id = EcsUp | EcsCascade;
+    d.terms[3].trav = EcsChildOf;
+    ecs_query_t* q = ecs_query_init(world, &d);
+    if (!q) return nullptr;
+    ecs_query_changed(q); // enables change tracking for the query
+    ecs_atfini(world, wt_query_forget, nullptr);
+    g_wt_queries.emplace(world, q);
+    return q;
+}
+
+void ameUpdateWorldTransforms(ecs_world_t* world) {
+    if (!world) return;
+    ecs_query_t* q = wt_query(world);
+    if (!q || !ecs_query_changed(q)) return;
+
+    ecs_iter_t it = ecs_query_iter(world, q);
+    while (ecs_query_next(&it)) {
+        if (!ecs_iter_changed(&it)) {
+            // Untouched subtree: leave the output column (and its change tick) alone
+            ecs_iter_skip(&it);
+            continue;
+        }
+        const AmeTransform2D* tr = ecs_field(&it, AmeTransform2D, 0);
+        const Scale2D* sc = ecs_field_is_set(&it, 1) ? ecs_field(&it, Scale2D, 1) : nullptr;
+        AmeWorldTransform2D* out = ecs_field(&it, AmeWorldTransform2D, 2);
+        const AmeWorldTransform2D* parent = ecs_field_is_set(&it, 3) ? ecs_field(&it, AmeWorldTransform2D, 3) : nullptr;
+        bool tr_self = ecs_field_is_self(&it, 0);
+        bool sc_self = ecs_field_is_self(&it, 1);
+        AmeWorldTransform2D root{0,0,0, 1,1};
+        const AmeWorldTransform2D& p = parent ? *parent : root;
+        for (int i = 0; i < it.count; ++i) {
+            const AmeTransform2D& l = tr[tr_self ? i : 0];
+            float lsx = sc ? sc[sc_self ? i : 0].sx : 1.0f;
+            float lsy = sc ? sc[sc_self ? i : 0].sy : 1.0f;
+            float rx, ry; rotate2(l.x, l.y, p.angle, rx, ry);
+            out[i].x = p.x + rx;
+            out[i].y = p.y + ry;
+            out[i].angle = p.angle + l.angle;
+            out[i].sx = p.sx * lsx;
+            out[i].sy = p.sy * lsy;
+        }
+    }
+}
+
+static void WorldTransformSystem(ecs_iter_t* it) {
+    ameUpdateWorldTransforms(it->world);
+}
+
+void ameRegisterTransformSystems(ecs_world_t* world) {
+    if (!world || ecs_lookup(world, "UnitylikeWorldTransforms")) return;
+    ecs_entity_desc_t ed = {0};
+    ed.name = "UnitylikeWorldTransforms";
+    ecs_id_t phase[] = { ecs_dependson(EcsPreStore), EcsPreStore, 0 };
+    ed.add = phase;
+    ecs_system_desc_t sd = {0};
+    sd.entity = ecs_entity_init(world, &ed);
+    sd.callback = WorldTransformSystem;
+    ecs_system_init(world, &sd);
+}
+
+AmeWorldTransform2D ameGetWorldTransform(ecs_world_t* world, ecs_entity_t e) {
+    if (!world || !e) return AmeWorldTransform2D{0,0,0, 1,1};
+    if (__t_script_job) {
+        // Job-safe FixedUpdate: read only. The values were propagated before the dispatch, so
+        // a transform written earlier in this step is not reflected yet.
+        const AmeWorldTransform2D* wt = (const AmeWorldTransform2D*)ecs_get_id(world, e, g_comp.world_transform);
+        return wt ? *wt : ameComputeWorldTransform(world, e);
+    }
+    ensure_components_registered(world);
+    if (!ecs_has_id(world, e, g_comp.world_transform)) return ameComputeWorldTransform(world, e);
+    ameUpdateWorldTransforms(world);
+    const AmeWorldTransform2D* wt = (const AmeWorldTransform2D*)ecs_get_id(world, e, g_comp.world_transform);
+    return wt ? *wt : ameComputeWorldTransform(world, e);
+}
+
 } // namespace unitylike
 
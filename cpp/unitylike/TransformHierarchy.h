@@ -24,6 +24,19 @@ struct AmeWorldTransform2D {
 // - Depth is capped to avoid cycles; if exceeded, traversal stops
 AmeWorldTransform2D ameComputeWorldTransform(ecs_world_t* world, ecs_entity_t e);
 
+// Cached world transforms (component g_comp.world_transform, stored as AmeWorldTransform2D).
+// Propagation walks a cascade query (parents before children) and skips tables whose local
+// transform, scale and parent world transform did not change since the previous run.
+// Returns immediately when nothing changed anywhere.
+void ameUpdateWorldTransforms(ecs_world_t* world);
+
+// Register the propagation system (EcsPreStore, i.e. after all gameplay phases, before rendering)
+void ameRegisterTransformSystems(ecs_world_t* world);
+
+// Up-to-date world transform of e: the cached component when present (propagating first if
+// anything is stale), otherwise ameComputeWorldTransform
+AmeWorldTransform2D ameGetWorldTransform(ecs_world_t* world, ecs_entity_t e);
+
 // Small helper to rotate a 2D vector by radians
 static inline void rotate2(float x, float y, float angle, float& ox, float& oy) {
     float cs = std::cos(angle);
@@ -12,6 +12,7 @@
 #include <string.h>
 
 #include "ame/ecs.h"
+#include "ame/ecs_commands.h"
 #include "ame/tilemap.h"
 #include "ame/physics.h"
 #include "ame/camera.h"
@@ -44,6 +45,8 @@ typedef struct CInput {
     float jump_buffer;     // time since jump pressed
     bool jump_trigger;     // set true when a jump occurs (consumed by audio)
 } CInput;
+// Raw key state written by the input thread through ame/ecs_commands.h
+typedef struct CInputState { int move_dir; bool jump_down; } CInputState;
 
 typedef struct CAnimation { int frame; float time; } CAnimation;
 
@@ -90,7 +93,7 @@ static AmeEcsWorld* g_world = NULL;
 static AmePhysicsWorld* g_physics = NULL;
 
 // ECS ids and entities
-static ecs_entity_t EcsCPlayerTag, EcsCSize, EcsCPhysicsBody, EcsCGrounded, EcsCInput, EcsCAnimation, EcsCAmbientAudio, EcsCCamera, EcsCTilemapRef, EcsCTextures, EcsCAudioRefs;
+static ecs_entity_t EcsCPlayerTag, EcsCSize, EcsCPhysicsBody, EcsCGrounded, EcsCInput, EcsCInputState, EcsCAnimation, EcsCAmbientAudio, EcsCCamera, EcsCTilemapRef, EcsCTextures, EcsCAudioRefs;
 static ecs_entity_t g_e_player = 0;
 static ecs_entity_t g_e_camera = 0;
 static ecs_entity_t g_e_world = 0;
@@ -103,10 +106,11 @@ static bool g_on_ground = false;
 
 // Input state
 static _Atomic bool g_should_quit = false;
-static _Atomic int g_move_dir = 0; // -1 left, 1 right, 0 none (derived from left/right)
-static _Atomic bool g_jump_down = false; // current key state
-static _Atomic bool g_left_down = false;
-static _Atomic bool g_right_down = false;
+// Key state is only touched on the input thread; changes reach the world as CInputState commands
+static bool g_jump_down = false;
+static bool g_left_down = false;
+static bool g_right_down = false;
+static _Atomic(AmeEcsCommands*) g_input_cmds = NULL;
 
 // Camera
 static AmeCamera g_camera = (AmeCamera){0};
@@ -378,18 +382,22 @@ static void on_input(const struct ni_event *ev, void *ud) {
         bool down = (ev->value != 0);
         
         if (ev->code == NI_KEY_LEFT || ev->code == NI_KEY_A) {
-            atomic_store(&g_left_down, down);
+            g_left_down = down;
         } else if (ev->code == NI_KEY_RIGHT || ev->code == NI_KEY_D) {
-            atomic_store(&g_right_down, down);
+            g_right_down = down;
         } else if (ev->code == NI_KEY_SPACE || ev->code == NI_KEY_W || ev->code == NI_KEY_UP) {
-            atomic_store(&g_jump_down, down);
+            g_jump_down = down;
         }
         if (down && (ev->code == NI_KEY_ESC || ev->code == NI_KEY_Q)) {
             atomic_store(&g_should_quit, true);
         }
-        // Derive move_dir atomically from left/right states to avoid missed transitions
-        int md = (atomic_load(&g_right_down) ? 1 : 0) - (atomic_load(&g_left_down) ? 1 : 0);
-        atomic_store(&g_move_dir, md);
+        // Applied by the logic thread at the start of its next ame_ecs_world_progress
+        AmeEcsCommands* cmds = atomic_load(&g_input_cmds);
+        if (cmds) {
+            CInputState st = { .move_dir = (g_right_down ? 1 : 0) - (g_left_down ? 1 : 0), .jump_down = g_jump_down };
+            ame_ecs_cmd_set(cmds, g_e_player, EcsCInputState, &st, sizeof st);
+            ame_ecs_commands_submit(cmds);
+        }
     }
 }
 
@@ -671,15 +679,10 @@ static void SysInputGather(ecs_iter_t *it) {
     }
     
     CInput *in = (CInput*)ecs_field(it, CInput, 0);
-    // Re-derive md here to ensure consistency if multiple updates happened between ticks
-    bool left = atomic_load(&g_left_down);
-    bool right = atomic_load(&g_right_down);
-    int md = (right ? 1 : 0) - (left ? 1 : 0);
-    bool jd = atomic_load(&g_jump_down);
-    
+    const CInputState *st = (const CInputState*)ecs_field(it, CInputState, 1);
     for (int i = 0; i < it->count; ++i) {
-        in[i].move_dir = md;
-        in[i].jump_down = jd;
+        in[i].move_dir = st[i].move_dir;
+        in[i].jump_down = st[i].jump_down;
     }
 }
 
@@ -814,6 +817,7 @@ static bool register_components_and_entities(void) {
     EcsCPhysicsBody  = ecs_component_init(w, &(ecs_component_desc_t){ .entity = ecs_entity_init(w, &(ecs_entity_desc_t){ .name = "CPhysicsBody" }), .type = { (int32_t)sizeof(CPhysicsBody), (int32_t)_Alignof(CPhysicsBody) } });
     EcsCGrounded     = ecs_component_init(w, &(ecs_component_desc_t){ .entity = ecs_entity_init(w, &(ecs_entity_desc_t){ .name = "CGrounded" }), .type = { (int32_t)sizeof(CGrounded), (int32_t)_Alignof(CGrounded) } });
     EcsCInput        = ecs_component_init(w, &(ecs_component_desc_t){ .entity = ecs_entity_init(w, &(ecs_entity_desc_t){ .name = "CInput" }), .type = { (int32_t)sizeof(CInput), (int32_t)_Alignof(CInput) } });
+    EcsCInputState   = ecs_component_init(w, &(ecs_component_desc_t){ .entity = ecs_entity_init(w, &(ecs_entity_desc_t){ .name = "CInputState" }), .type = { (int32_t)sizeof(CInputState), (int32_t)_Alignof(CInputState) } });
     EcsCAnimation    = ecs_component_init(w, &(ecs_component_desc_t){ .entity = ecs_entity_init(w, &(ecs_entity_desc_t){ .name = "CAnimation" }), .type = { (int32_t)sizeof(CAnimation), (int32_t)_Alignof(CAnimation) } });
     EcsCAmbientAudio = ecs_component_init(w, &(ecs_component_desc_t){ .entity = ecs_entity_init(w, &(ecs_entity_desc_t){ .name = "CAmbientAudio" }), .type = { (int32_t)sizeof(CAmbientAudio), (int32_t)_Alignof(CAmbientAudio) } });
     EcsCCamera       = ecs_component_init(w, &(ecs_component_desc_t){ .entity = ecs_entity_init(w, &(ecs_entity_desc_t){ .name = "CCamera" }), .type = { (int32_t)sizeof(CCamera), (int32_t)_Alignof(CCamera) } });
@@ -1055,6 +1059,7 @@ static void instantiate_world_entities(void) {
 
     CGrounded gr = { .value = false }; ecs_set_id(w, g_e_player, EcsCGrounded, sizeof(CGrounded), &gr);
     CInput in = (CInput){0}; ecs_set_id(w, g_e_player, EcsCInput, sizeof(CInput), &in);
+    CInputState ist = (CInputState){0}; ecs_set_id(w, g_e_player, EcsCInputState, sizeof(CInputState), &ist);
     CAnimation an = (CAnimation){ .frame = 0, .time = 0.0f }; ecs_set_id(w, g_e_player, EcsCAnimation, sizeof(CAnimation), &an);
 }
 
@@ -1069,6 +1074,7 @@ static void register_systems(void) {
     });
     d.callback = SysInputGather;
     d.query.terms[0].id = EcsCInput;
+    d.query.terms[1].id = EcsCInputState;
     ecs_system_init(w, &d);
 
     memset(&d, 0, sizeof d);
@@ -1176,7 +1182,7 @@ static int logic_thread_main(void *ud) {
             if ((frame_counter++ % 1000) == 0) {
                 LOGD("[logic_thread] Calling ecs_progress, frame %d", frame_counter);
             }
-            ecs_progress(w, (float)fixed_dt);
+            ame_ecs_world_progress(g_world, fixed_dt);
             ame_physics_world_step(g_physics);
             acc -= fixed_dt;
             steps++;
@@ -1194,6 +1200,7 @@ static SDL_AppResult init_world(void) {
     if (!setup_audio()) return SDL_APP_FAILURE;
     instantiate_world_entities();
     register_systems();
+    atomic_store(&g_input_cmds, ame_ecs_commands_create(g_world));
 
     g_logic_thread = SDL_CreateThread(logic_thread_main, "logic", NULL);
     if (!g_logic_thread) { LOGD("Failed to start logic thread: %s", SDL_GetError()); return SDL_APP_FAILURE; }
@@ -1433,6 +1440,9 @@ void SDL_AppQuit(void *appstate, SDL_AppResult result) {
     (void)appstate; (void)result;
 
     atomic_store(&g_should_quit, true);
+    // Stop input first: on_input submits to g_input_cmds, which the world frees on destroy
+    ni_shutdown();
+    atomic_store(&g_input_cmds, NULL);
     if (g_logic_thread) { SDL_WaitThread(g_logic_thread, NULL); g_logic_thread = NULL; }
     if (g_audio_thread) { SDL_WaitThread(g_audio_thread, NULL); g_audio_thread = NULL; }
     
@@ -1459,7 +1469,6 @@ void SDL_AppQuit(void *appstate, SDL_AppResult result) {
     }
     ame_ecs_world_destroy(g_world);
     
-    ni_shutdown();
     shutdown_gl();
     ame_audio_shutdown();
     // SDL3_image doesn't need explicit quit
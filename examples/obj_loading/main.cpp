@@ -270,7 +270,7 @@ static SDL_AppResult init_app(void) {
                 sd.u0 = 0.0f; sd.v0 = 0.0f; sd.u1 = 1.0f; sd.v1 = 1.0f;
                 sd.w = radius * 2.0f; sd.h = radius * 2.0f;
                 sd.r = 1.0f; sd.g = 1.0f; sd.b = 1.0f; sd.a = 1.0f;
-                sd.visible = 1; sd.sorting_layer = 0; sd.order_in_layer = 0; sd.z = 0.0f; sd.dirty = 1;
+                sd.visible = 1; sd.sorting_layer = 0; sd.order_in_layer = 0; sd.z = 0.0f;
                 ecs_set_id(world, e, unitylike::g_comp.sprite, sizeof(sd), &sd);
 
                 // Add circle collider
@@ -312,7 +312,7 @@ static SDL_AppResult init_app(void) {
     }
 
     // Load textures referenced by .mtl into Material.tex (no Sprite needed)
-    struct MaterialData { uint32_t tex; float r,g,b,a; int dirty; };
+    struct MaterialData { uint32_t tex; float r,g,b,a; };
     struct MaterialTexPath { const char* path; };
     auto load_texture_rgba8 = [](const char* path) -> GLuint {
         if (!path || !*path) return 0;
@@ -357,7 +357,6 @@ static SDL_AppResult init_app(void) {
                 }
                 if (tex) {
                     m->tex = tex;
-                    m->dirty = 1;
                     ecs_set_id(world, it.entities[i], mat_id, sizeof(MaterialData), m);
                     SDL_Log("[OBJ_EXAMPLE] Bound material texture %u to entity %llu (%s)", tex, (unsigned long long)it.entities[i], key.c_str());
                 } else {
@@ -1,5 +1,6 @@
 #pragma once
 #include "unitylike/Scene.h"
+#include "unitylike/Coroutine.h"
 #include "PlayerBehaviour.h"
 #include "CameraController.h"
 #include "PhysicsManager.h"
@@ -45,9 +46,6 @@ private:
     DebugRenderer debugRenderer;
     bool showColliderDebug = true;
     
-    // Delayed initialization
-    bool textureLoaded = false;
-    
 public:
     void Start() override {
         SDL_Log("GameManager: Start() called - beginning scene setup");
@@ -71,14 +69,17 @@ public:
         LinkComponents();
         
         SDL_Log("GameManager: Scene setup complete");
+        
+        // Delayed initialization: a coroutine instead of a flag polled in Update
+        StartCoroutine(DelayedTextureLoad());
     }
     
-    void Update(float deltaTime) override {
-        // Load texture on the first update after everything is initialized
-        if (!textureLoaded && playerBehaviour) {
-            SDL_Log("GameManager: Delayed texture loading in Update()");
+    // Load texture on the first update after everything is initialized
+    Coroutine DelayedTextureLoad() {
+        co_await WaitForFrames(1);
+        if (playerBehaviour) {
+            SDL_Log("GameManager: Delayed texture loading");
             LoadPlayerSprite();
-            textureLoaded = true;
         }
     }
     
@@ -7,6 +7,7 @@ extern "C" {
 
 #include <flecs.h>
 #include "ame/physics.h"
+#include "ame/collider_decompose.h"
 #include <stddef.h>
 
 // Mirror of façade Col2D POD used by collider2d_system.c
@@ -22,12 +23,30 @@ typedef struct Col2D {
 // PODs used by extras systems (edge/chain/mesh). Keeping them C-only for use in .c files too.
 typedef struct EdgeCol2D { float x1,y1,x2,y2; int isTrigger; int dirty; } EdgeCol2D;
 typedef struct ChainCol2D { const float* points; size_t count; int isLoop; int isTrigger; int dirty; } ChainCol2D;
-typedef struct MeshCol2D { const float* vertices; size_t count; int isTrigger; int dirty; } MeshCol2D;
-
-// Register a simple Collider2D apply system that synchronizes trigger flags on AmePhysicsBody
-// and clears dirty. Intended as a stepping stone until fixture (re)creation helpers are added.
+// MeshCol2D: vertices is a triangle soup [ax,ay,bx,by,cx,cy,...], count = vertex count (3 per triangle).
+// decomp caches the convex decomposition used for fixtures; it is built on first apply when NULL.
+// The component owns the cache (hooks of ame_mesh_collider2d_component): it is freed with the
+// component, moves with it, and a copy (ecs_set_id included) drops it and is marked dirty. To
+// hand over a prebuilt cache, write it through ecs_ensure_id. Whoever replaces vertices in place
+// must ame_convex_decomp_free + free the cache and reset it to NULL.
+typedef struct MeshCol2D { const float* vertices; size_t count; int isTrigger; int dirty; AmeConvexDecomp* decomp; } MeshCol2D;
+
+// The "MeshCollider2D" component id, registered with the decomp ownership hooks on first use
+// (also added to a "MeshCollider2D" someone else registered without them).
+// It is (OnInstantiate, DontInherit): prefab instances do not receive it.
+ecs_entity_t ame_mesh_collider2d_component(ecs_world_t* w);
+
+// Register the Collider2D apply observers (OnSet of the collider or AmePhysicsBody). Dirty
+// box/circle colliders become a single native Box2D fixture, resized in place when possible;
+// edge/chain/mesh colliders rebuild fixtures. Observers run where the set happens (or at the
+// merge of deferred sets on the main thread), never per frame; don't set colliders during a step.
 void ame_collider2d_system_register(ecs_world_t* w);
 
+// Register SysPhysicsWriteback (EcsPostUpdate): copies each body's pose from the physics pose
+// cache (or the b2Body for unregistered bodies) into its AmeTransform2D. It only reads physics
+// state, so it is multi_threaded; step `physics` outside ecs_progress or in a main-thread system.
+void ame_physics_writeback_system_register(ecs_world_t* w, AmePhysicsWorld* physics);
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,40 @@
+#ifndef AME_COLLIDER_DECOMPOSE_H
+#define AME_COLLIDER_DECOMPOSE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Box2D's b2_maxPolygonVertices; merged polygons never exceed this
+#define AME_DECOMP_MAX_POLY_VERTS 8
+
+// Convex decomposition of a 2D triangle soup (Hertel-Mehlhorn style merge).
+// Polygons are stored back to back, counter-clockwise, without collinear vertices.
+// Polygon i spans verts[offsets[i]*2 .. offsets[i+1]*2).
+typedef struct AmeConvexDecomp {
+    float* verts;          // [x0,y0,x1,y1,...] for all polygons
+    uint32_t* offsets;     // poly_count+1 entries, in vertices
+    size_t poly_count;
+    size_t vert_count;
+    size_t source_triangles; // non-degenerate input triangles
+} AmeConvexDecomp;
+
+// Merge triangles [ax,ay,bx,by,cx,cy,...] (tri_count*6 floats) into convex polygons with at most
+// max_poly_verts vertices (clamped to 3..AME_DECOMP_MAX_POLY_VERTS). Shared vertices are welded
+// with a size-relative tolerance; degenerate triangles are dropped. The union of the output
+// polygons covers exactly the input triangles. Returns false on allocation failure or empty input.
+bool ame_convex_decompose_triangles(const float* tri_vertices, size_t tri_count,
+                                    int max_poly_verts, AmeConvexDecomp* out);
+
+// Release arrays owned by a decomposition (the struct itself is not freed)
+void ame_convex_decomp_free(AmeConvexDecomp* d);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AME_COLLIDER_DECOMPOSE_H
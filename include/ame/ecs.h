@@ -17,8 +17,15 @@ typedef struct AmeEcsWorld AmeEcsWorld;
 typedef uint64_t AmeEcsId;
 
 // Create a new ECS world. Returns NULL on failure.
+// Worker threads default to the AME_ECS_THREADS environment variable (unset/<=1: single-threaded).
 AmeEcsWorld* ame_ecs_world_create(void);
 
+// Number of Flecs worker threads for multi_threaded systems; <=1 runs everything on the
+// calling thread, 0 picks hardware concurrency. Systems that are not multi_threaded still
+// run on the main thread and act as sync points. Call between frames.
+void ame_ecs_world_set_threads(AmeEcsWorld* w, int threads);
+int ame_ecs_world_get_threads(AmeEcsWorld* w);
+
 // Progress the world by delta_time seconds. Returns false to request quit.
 bool ame_ecs_world_progress(AmeEcsWorld* w, double delta_time);
 
@@ -31,6 +38,31 @@ AmeEcsId ame_ecs_entity_new(AmeEcsWorld* w);
 void ame_ecs_set(AmeEcsWorld* w, AmeEcsId e, AmeEcsId comp, const void* data, size_t size);
 bool ame_ecs_get(AmeEcsWorld* w, AmeEcsId e, AmeEcsId comp, void* out, size_t size);
 
+// Create `count` entities that share the same `component_count` components, placed directly in
+// their final table (no per-component table moves). component_data[i] points to `count` packed
+// values for component_ids[i]; pass NULL (or a NULL entry) to leave components default-initialized.
+// Created ids are written to out_entities when non-NULL. Returns the number of entities created,
+// 0 on invalid input (more than 31 components, count above INT32_MAX).
+size_t ame_ecs_bulk_create(AmeEcsWorld* w, size_t count,
+                           const AmeEcsId* component_ids, const void* const* component_data,
+                           size_t component_count, AmeEcsId* out_entities);
+
+// Prefabs (Flecs IsA). A prefab is an entity that queries and systems skip; instances point at
+// it and read the components marked shared straight from it until they set their own value,
+// which adds an override to that instance only (copy-on-write). Components not marked shared
+// are copied into each instance when it is created.
+// Mark a component as inherited by instances instead of copied. Call right after registering
+// it, before queries or observers on it exist.
+void ame_ecs_component_set_shared(AmeEcsWorld* w, AmeEcsId comp);
+// New prefab entity (name may be NULL). Set its components like any entity's.
+AmeEcsId ame_ecs_prefab_new(AmeEcsWorld* w, const char* name);
+// ame_ecs_bulk_create for `count` instances of prefab: the listed components are stored per
+// instance, shared ones stay on the prefab. Returns the number created, 0 on invalid input
+// (more than 30 components).
+size_t ame_ecs_instantiate(AmeEcsWorld* w, AmeEcsId prefab, size_t count,
+                           const AmeEcsId* component_ids, const void* const* component_data,
+                           size_t component_count, AmeEcsId* out_entities);
+
 // Hierarchy utilities (uses Flecs EcsChildOf relationship)
 // Set parent for child. Pass parent=0 to clear parent. Returns true on success.
 bool ame_ecs_set_parent(AmeEcsWorld* w, AmeEcsId child, AmeEcsId parent);
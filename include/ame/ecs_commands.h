@@ -0,0 +1,55 @@
+#ifndef AME_ECS_COMMANDS_H
+#define AME_ECS_COMMANDS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Deferred ECS mutation from threads that must not touch the Flecs world (input, audio, loaders).
+//
+// Each recording thread owns one AmeEcsCommands recorder. Commands are appended to the
+// recorder's open batch without locks or atomics. ame_ecs_commands_submit hands the batch to the
+// world with a single lock-free push. The world applies submitted batches at the start of
+// ame_ecs_world_progress, or at ame_ecs_commands_flush on the thread that progresses the world.
+// Batches apply in submission order; commands inside a batch apply in recording order.
+//
+// ame_ecs_cmd_create returns a placeholder id that other commands of the same batch may use (as
+// entity, pair relationship or pair target). The placeholder stops being valid at submit.
+// Commands on entities that are no longer alive at apply time are skipped.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "ame/ecs.h"
+
+typedef struct AmeEcsCommands AmeEcsCommands;
+
+// Placeholder ids carry this bit. It is never set on a Flecs entity id, but it is ECS_AUTO_OVERRIDE
+// on component ids, so it is only resolved where an entity goes: the command's entity and the two
+// halves of ame_ecs_cmd_add_pair. Component ids are applied as recorded.
+#define AME_ECS_CMD_PLACEHOLDER (1ull << 62)
+
+// Create a recorder for the calling thread. Recorders belong to the world and are freed by
+// ame_ecs_world_destroy. Safe to call from any thread.
+AmeEcsCommands* ame_ecs_commands_create(AmeEcsWorld* w);
+
+AmeEcsId ame_ecs_cmd_create(AmeEcsCommands* c);
+// Copies `size` bytes of data; size must match the component
+void ame_ecs_cmd_set(AmeEcsCommands* c, AmeEcsId e, AmeEcsId comp, const void* data, size_t size);
+void ame_ecs_cmd_add(AmeEcsCommands* c, AmeEcsId e, AmeEcsId id);
+void ame_ecs_cmd_add_pair(AmeEcsCommands* c, AmeEcsId e, AmeEcsId relationship, AmeEcsId target);
+void ame_ecs_cmd_remove(AmeEcsCommands* c, AmeEcsId e, AmeEcsId id);
+void ame_ecs_cmd_destroy(AmeEcsCommands* c, AmeEcsId e);
+
+// Publish everything recorded since the last submit. Returns false when out of memory (the
+// batch is dropped). Empty batches are not published.
+bool ame_ecs_commands_submit(AmeEcsCommands* c);
+
+// Apply all submitted batches now. Call only on the thread that progresses the world, outside
+// ame_ecs_world_progress. Returns the number of commands applied.
+size_t ame_ecs_commands_flush(AmeEcsWorld* w);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AME_ECS_COMMANDS_H
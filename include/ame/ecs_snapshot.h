@@ -0,0 +1,84 @@
+#ifndef AME_ECS_SNAPSHOT_H
+#define AME_ECS_SNAPSHOT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Versioned binary snapshot of an ECS world: the entities that carry at least one schema
+// component, prefabs and disabled entities included, their component columns (one record per
+// Flecs table), ChildOf hierarchy, IsA prefab links and names. Prefab instances store only their
+// own columns; inherited values come back through the IsA pair.
+//
+// Loading maps the file and recreates each table with one ecs_bulk_init call, so entities land
+// in their final archetype directly. Tables are written with ChildOf/IsA targets before the
+// tables pointing at them, and a prefab's children after its instances. Plain components are
+// copied straight out of the mapping; components holding pointers need an AmeSnapshotSerializer
+// (when Flecs meta describes a component, raw registration of pointer-bearing types is refused).
+//
+// Layout (little-endian; strings and column data are zero-padded to 8 bytes):
+//   header   "AMESNAP\0", u32 version, u32 component_count, u32 table_count, u32 name_count, u64 entity_count
+//   components  per component: u32 name_len, name, u32 size, u32 flags (1 = serialized)
+//   tables   per table: u32 column_count, u32 parent (index + 1, 0 = none), u32 base (IsA target,
+//            index + 1, 0 = none), u32 flags (1 = disabled, 2 = prefab), u32 first_entity, u32 rows,
+//            u32 component[column_count], then per column: u64 bytes, data
+//   names    per name: u32 entity, u32 len, chars
+// Entities are numbered in table order; `first_entity` is the index of the table's first row.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <flecs.h>
+
+#define AME_SNAPSHOT_VERSION 3u
+
+typedef struct AmeSnapshotSchema AmeSnapshotSchema;
+typedef struct AmeSnapshotWriter AmeSnapshotWriter;
+typedef struct AmeSnapshotFile AmeSnapshotFile;
+
+// Append bytes to the column being written. Returns false when out of memory.
+bool ame_snapshot_write(AmeSnapshotWriter* out, const void* data, size_t size);
+
+// Custom column codec for components holding pointers (meshes, heap strings).
+// save: append `count` values (one table column) to `out`.
+// load: fill `count` zero-initialized values from the bytes written by save. `data` points into
+//       the snapshot file, which stays mapped until ame_snapshot_file_close, so values may keep
+//       pointers into it instead of copying. Returning false aborts the load; load releases
+//       what it allocated for the values it had filled.
+// discard (optional): release what load allocated when its column never reaches the world
+//       because a later column of the same table failed.
+typedef struct AmeSnapshotSerializer {
+    bool (*save)(const void* values, int32_t count, AmeSnapshotWriter* out, void* user);
+    bool (*load)(void* values, int32_t count, const uint8_t* data, size_t size, void* user);
+    void* user;
+    void (*discard)(void* values, int32_t count, void* user);
+} AmeSnapshotSerializer;
+
+AmeSnapshotSchema* ame_snapshot_schema_create(void);
+void ame_snapshot_schema_destroy(AmeSnapshotSchema* schema);
+
+// Add a component by id; it is matched by name on load. serializer NULL stores raw bytes.
+// Returns false for unnamed/zero-size components, more than 27 components, or a pointer-bearing
+// type (per Flecs meta) without a serializer.
+bool ame_snapshot_schema_add(AmeSnapshotSchema* schema, ecs_world_t* w, ecs_entity_t component,
+                             const AmeSnapshotSerializer* serializer);
+
+// Save every entity with at least one schema component. Returns false on I/O or serializer failure,
+// or when ChildOf and IsA links form a cycle between tables.
+bool ame_snapshot_save(ecs_world_t* w, const AmeSnapshotSchema* schema, const char* path);
+
+// Load a snapshot into `w` (new entity ids; schema components are resolved by name in `w`).
+// The returned file must outlive any component data that points into it; NULL on failure.
+// out_entity_count (optional) receives the number of entities created.
+AmeSnapshotFile* ame_snapshot_load(ecs_world_t* w, const AmeSnapshotSchema* schema, const char* path,
+                                   size_t* out_entity_count);
+// Same, from a caller-owned buffer that must stay valid like the mapped file.
+bool ame_snapshot_load_memory(ecs_world_t* w, const AmeSnapshotSchema* schema,
+                              const void* data, size_t size, size_t* out_entity_count);
+void ame_snapshot_file_close(AmeSnapshotFile* file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AME_ECS_SNAPSHOT_H
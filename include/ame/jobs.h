@@ -0,0 +1,35 @@
+#ifndef AME_JOBS_H
+#define AME_JOBS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+// Minimal fork/join worker pool.
+// ame_jobs_parallel_for runs fn(ctx, i) for every i in [0, count) on the workers plus the calling
+// thread and returns once all indices are done (join barrier). Indices are claimed in ascending
+// order, so put the most expensive items first. Calls from inside a job run inline on that thread;
+// concurrent callers on the same pool are serialized.
+typedef struct AmeJobPool AmeJobPool;
+
+typedef void (*AmeJobFn)(void* ctx, size_t index);
+
+// worker_count <= 0: hardware threads - 1 (the caller is the extra thread). 0 workers is valid.
+AmeJobPool* ame_jobs_create(int worker_count);
+void ame_jobs_destroy(AmeJobPool* pool);
+
+int ame_jobs_worker_count(const AmeJobPool* pool);
+
+// A NULL pool runs the loop serially on the calling thread
+void ame_jobs_parallel_for(AmeJobPool* pool, size_t count, AmeJobFn fn, void* ctx);
+
+// Process-wide pool created on first use with the default worker count; lives until exit
+AmeJobPool* ame_jobs_shared(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AME_JOBS_H
@@ -8,6 +8,7 @@ extern "C" {
 #include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
+#include "ame/jobs.h"
 
 // Forward declarations for Box2D C++ types (opaque to C)
 typedef struct b2World b2World;
@@ -17,14 +18,22 @@ typedef struct b2Body b2Body;
 typedef struct AmeEcsWorld AmeEcsWorld;
 typedef uint64_t AmeEcsId;
 
+// Internal per-world bookkeeping (body registry, pose cache); opaque to callers
+typedef struct AmePhysicsWorldState AmePhysicsWorldState;
+
 // Physics world wrapper
 typedef struct AmePhysicsWorld {
     b2World* world;
     float timestep;        // Fixed timestep for simulation (e.g., 1/60.0f)
     int velocity_iters;    // Velocity iterations for solver
     int position_iters;    // Position iterations for solver
+    AmePhysicsWorldState* state;
 } AmePhysicsWorld;
 
+// Generation-checked body handle: (generation << 32) | (slot + 1). 0 is never valid.
+typedef uint64_t AmeBodyHandle;
+#define AME_BODY_HANDLE_INVALID ((AmeBodyHandle)0)
+
 // Body types
 typedef enum AmeBodyType {
     AME_BODY_STATIC = 0,
@@ -38,6 +47,7 @@ typedef struct AmePhysicsBody {
     float width;           // For box shapes
     float height;          // For box shapes
     bool is_sensor;        // Whether this body is a sensor (no collision response)
+    AmeBodyHandle handle;  // Registry handle (0 when the body was not created via ame_physics_create_body)
 } AmePhysicsBody;
 
 // Transform component for synchronization with physics
@@ -53,7 +63,8 @@ typedef struct AmeRaycastHit {
     float normal_x, normal_y; // Surface normal at hit point
     float fraction;       // Distance along ray (0 to 1)
     b2Body* body;         // Body that was hit
-    void* user_data;      // Optional user data from the body
+    void* user_data;      // Optional user data from the body (caller-owned payload, e.g. AmeAcousticMaterial*)
+    uint64_t entity;      // Entity linked in the body registry, 0 if none
 } AmeRaycastHit;
 
 // Initialize physics world with gravity
@@ -65,6 +76,20 @@ void ame_physics_world_destroy(AmePhysicsWorld* world);
 // Step the physics simulation
 void ame_physics_world_step(AmePhysicsWorld* world);
 
+// Called after every step of the world (including parallel steps) on the thread that requested it.
+// Gameplay reactions belong here rather than in Box2D listeners, which run inside Step.
+typedef void (*AmePhysicsStepCallback)(AmePhysicsWorld* world, void* user);
+void ame_physics_world_set_post_step(AmePhysicsWorld* world, AmePhysicsStepCallback fn, void* user);
+
+// Step independent worlds concurrently, one world per job, and return after all of them finished.
+// Worlds must be distinct and must not share bodies, listeners or user state that is written during
+// Step; nothing else may touch them until the call returns. Box2D contact/destruction listeners run
+// on worker threads; post-step callbacks run afterwards on the calling thread, in array order.
+// Total time approaches the slowest world instead of the sum. NULL entries are skipped.
+void ame_physics_worlds_step_parallel(AmePhysicsWorld* const* worlds, size_t count);
+// Same, on a specific pool (NULL steps serially)
+void ame_physics_worlds_step_parallel_pool(AmeJobPool* pool, AmePhysicsWorld* const* worlds, size_t count);
+
 // Create a physics body
 b2Body* ame_physics_create_body(AmePhysicsWorld* world, float x, float y, 
                                 float width, float height, AmeBodyType type,
@@ -79,17 +104,60 @@ void ame_physics_create_tilemap_collision(AmePhysicsWorld* world,
 // Destroy a physics body
 void ame_physics_destroy_body(AmePhysicsWorld* world, b2Body* body);
 
+// New body with src's type, damping, flags, user data and fixtures at (x, y, angle); registered
+// like ame_physics_create_body. NULL inside a step.
+b2Body* ame_physics_clone_body(AmePhysicsWorld* world, b2Body* src, float x, float y, float angle);
+
+// ---- Body registry ----
+// Every body made by ame_physics_create_body is registered and gets a handle. Destroying the body
+// bumps the slot generation so old handles stop resolving instead of dangling.
+AmeBodyHandle ame_physics_register_body(AmePhysicsWorld* world, b2Body* body, uint64_t entity);
+AmeBodyHandle ame_physics_body_handle(const AmePhysicsWorld* world, const b2Body* body);
+b2Body* ame_physics_body_get(const AmePhysicsWorld* world, AmeBodyHandle handle);
+bool ame_physics_body_valid(const AmePhysicsWorld* world, AmeBodyHandle handle);
+void ame_physics_destroy_body_handle(AmePhysicsWorld* world, AmeBodyHandle handle);
+
+// Body <-> entity mapping (entity 0 = unlinked)
+void ame_physics_body_set_entity(AmePhysicsWorld* world, AmeBodyHandle handle, uint64_t entity);
+uint64_t ame_physics_body_entity(const AmePhysicsWorld* world, AmeBodyHandle handle);
+AmeBodyHandle ame_physics_entity_body(const AmePhysicsWorld* world, uint64_t entity);
+
+// Dense SoA pose cache of registered bodies, refreshed once per ame_physics_world_step.
+// Pointers stay valid until the next create/destroy/step; index i is the same body in every array.
+typedef struct AmePhysicsPoses {
+    size_t count;
+    const float* x;
+    const float* y;
+    const float* angle;
+    const float* vx;
+    const float* vy;
+    const uint8_t* awake;
+    const uint64_t* entity;
+    const AmeBodyHandle* handle;
+} AmePhysicsPoses;
+
+AmePhysicsPoses ame_physics_get_poses(const AmePhysicsWorld* world);
+
+// Cached pose of one body (as of the last step); false for stale handles
+bool ame_physics_body_pose(const AmePhysicsWorld* world, AmeBodyHandle handle,
+                           AmeTransform2D* out_transform, float* out_vx, float* out_vy);
+
 // Get/set body position
 void ame_physics_get_position(b2Body* body, float* x, float* y);
 void ame_physics_set_position(b2Body* body, float x, float y);
 
-// Set body rotation angle (radians)
+// Get/set body rotation angle (radians)
+float ame_physics_get_angle(b2Body* body);
 void ame_physics_set_angle(b2Body* body, float angle);
 
 // Get/set body velocity
 void ame_physics_get_velocity(b2Body* body, float* vx, float* vy);
 void ame_physics_set_velocity(b2Body* body, float vx, float vy);
 
+// Get/set body angular velocity (radians/second)
+float ame_physics_get_angular_velocity(b2Body* body);
+void ame_physics_set_angular_velocity(b2Body* body, float w);
+
 // Perform a raycast
 AmeRaycastHit ame_physics_raycast(AmePhysicsWorld* world, 
                                   float start_x, float start_y,
@@ -108,6 +176,132 @@ AmeRaycastMultiHit ame_physics_raycast_all(AmePhysicsWorld* world,
                                            size_t max_hits);
 void ame_physics_raycast_free(AmeRaycastMultiHit* multi_hit);
 
+// ---- Area and shape queries ----
+// Both walk Box2D's broadphase tree once per query and write into caller-owned arrays; nothing is
+// allocated. Hits are per fixture, so a body with several matching fixtures appears more than once.
+typedef struct AmeQueryFilter {
+    uint16_t category_mask;   // fixture matches when (filter.categoryBits & category_mask) != 0; 0 = all
+    bool include_sensors;
+} AmeQueryFilter;
+
+typedef struct AmeQueryHit {
+    b2Body* body;
+    AmeBodyHandle handle;     // AME_BODY_HANDLE_INVALID for unregistered bodies
+    uint64_t entity;          // registry entity, 0 if none
+    void* user_data;          // body user_data
+    // Shape casts only: first contact along the sweep. Shapes overlapping at the start report
+    // fraction 0, the cast origin as point and a zero normal.
+    float point_x, point_y;
+    float normal_x, normal_y;
+    float fraction;           // 0..1 of the translation
+} AmeQueryHit;
+
+// Fixtures whose tight AABB overlaps [min, max]. Returns hits written (<= capacity); out_total
+// (optional) receives the full match count. With out_total NULL the walk stops once the buffer is full.
+// filter NULL matches every non-sensor fixture.
+size_t ame_physics_query_aabb(const AmePhysicsWorld* world,
+                              float min_x, float min_y, float max_x, float max_y,
+                              const AmeQueryFilter* filter,
+                              AmeQueryHit* out_hits, size_t capacity, size_t* out_total);
+
+typedef struct AmeAabbQuery {
+    float min_x, min_y, max_x, max_y;
+} AmeAabbQuery;
+
+// Query i writes to out_hits[i * capacity_per_query] and its hit count to out_counts[i]
+void ame_physics_query_aabb_batch(const AmePhysicsWorld* world,
+                                  const AmeAabbQuery* queries, size_t query_count,
+                                  const AmeQueryFilter* filter,
+                                  AmeQueryHit* out_hits, size_t capacity_per_query, size_t* out_counts);
+
+typedef enum AmeQueryShapeType {
+    AME_QUERY_BOX = 0,
+    AME_QUERY_CIRCLE = 1
+} AmeQueryShapeType;
+
+// Sweep of a box (half extents, angle) or circle from (x, y) by (dx, dy)
+typedef struct AmeShapeCast {
+    int type;                 // AmeQueryShapeType
+    float half_w, half_h;     // box
+    float radius;             // circle
+    float angle;
+    float x, y;
+    float dx, dy;
+} AmeShapeCast;
+
+// Fixtures hit by the sweep, closest first; keeps the nearest `capacity` hits. Returns hits written.
+size_t ame_physics_shape_cast(const AmePhysicsWorld* world, const AmeShapeCast* cast,
+                              const AmeQueryFilter* filter,
+                              AmeQueryHit* out_hits, size_t capacity);
+
+// Cast i writes to out_hits[i * capacity_per_cast] and its hit count to out_counts[i]
+void ame_physics_shape_cast_batch(const AmePhysicsWorld* world,
+                                  const AmeShapeCast* casts, size_t cast_count,
+                                  const AmeQueryFilter* filter,
+                                  AmeQueryHit* out_hits, size_t capacity_per_cast, size_t* out_counts);
+
+// ---- Profiling / counters ----
+// Snapshot of physics cost. Timings come from Box2D's b2Profile for the last step; counts are
+// gathered when queried, raycast counters accumulate between steps. Cheap enough for release builds.
+typedef struct AmePhysicsStats {
+    // Last step, milliseconds (b2Profile)
+    float step_ms;
+    float collide_ms;
+    float solve_ms;
+    float solve_init_ms;
+    float solve_velocity_ms;
+    float solve_position_ms;
+    float solve_toi_ms;
+    float broadphase_ms;
+    float wall_step_ms;        // measured around ame_physics_world_step, includes pose cache refresh
+    // World population
+    int32_t body_count;
+    int32_t awake_body_count;  // non-static bodies that are awake
+    int32_t static_body_count;
+    int32_t contact_count;     // broadphase pairs
+    int32_t touching_contact_count;
+    int32_t proxy_count;
+    int32_t joint_count;
+    int32_t tree_height;
+    uint32_t registered_body_count;
+    // Queries since the last step
+    uint32_t raycast_count;
+    float raycast_ms;
+    uint64_t step_count;
+    uint32_t parked_body_count; // bodies disabled by region activation (physics_activation.h)
+} AmePhysicsStats;
+
+void ame_physics_get_stats(const AmePhysicsWorld* world, AmePhysicsStats* out_stats);
+
+// ---- Contact events ----
+// A contact listener records begin/end of touching pairs during Step into a preallocated buffer.
+// After each step the batch is published as one array, so systems walk only the pairs that changed
+// instead of polling per entity. Pairs where either fixture is a sensor are reported as triggers.
+// Ends caused by destroying or parking a body outside Step are delivered with the next step.
+typedef enum AmeContactEventType {
+    AME_CONTACT_BEGIN = 0,
+    AME_CONTACT_END,
+    AME_TRIGGER_ENTER,
+    AME_TRIGGER_EXIT
+} AmeContactEventType;
+
+typedef struct AmeContactEvent {
+    uint64_t entity_a, entity_b;     // registry entities, 0 if the body has none
+    AmeBodyHandle body_a, body_b;    // AME_BODY_HANDLE_INVALID for unregistered bodies
+    float point_x, point_y;          // first manifold point (BEGIN only)
+    float normal_x, normal_y;        // from A to B (BEGIN only)
+    uint8_t type;                    // AmeContactEventType
+    uint8_t point_count;             // 0 for sensors and END/EXIT
+} AmeContactEvent;
+
+// Install the listener with room for capacity events per step; 0 removes it. Events beyond
+// capacity are dropped and counted. Replaces any contact listener set directly on the b2World.
+void ame_physics_contact_events_enable(AmePhysicsWorld* world, size_t capacity);
+
+// Events from the last step. Valid until the next step; out_dropped (optional) counts overflow.
+const AmeContactEvent* ame_physics_get_contact_events(const AmePhysicsWorld* world,
+                                                     size_t* out_count, uint32_t* out_dropped);
+
 // Register physics components with ECS
 AmeEcsId ame_physics_register_body_component(AmeEcsWorld* w);
 AmeEcsId ame_physics_register_transform_component(AmeEcsWorld* w);
@@ -139,6 +333,26 @@ void ame_physics_add_mesh_triangles_world(b2Body* body,
                                           const float* vertices, size_t tri_count,
                                           bool is_sensor, float density, float friction);
 
+// Add convex polygon fixtures from WORLD coordinates, e.g. an AmeConvexDecomp.
+// Polygon i spans verts[offsets[i]*2 .. offsets[i+1]*2) and must have 3..8 vertices.
+void ame_physics_add_convex_polygons_world(b2Body* body,
+                                           const float* verts, const uint32_t* offsets, size_t poly_count,
+                                           bool is_sensor, float density, float friction);
+
+// Add a native box fixture (b2PolygonShape::SetAsBox) centered on the body origin
+void ame_physics_add_box_fixture(b2Body* body, float width, float height,
+                                 bool is_sensor, float density, float friction);
+
+// Add a native circle fixture (b2CircleShape) centered on the body origin
+void ame_physics_add_circle_fixture(b2Body* body, float radius,
+                                    bool is_sensor, float density, float friction);
+
+// Resize/retag an existing single box or circle fixture in place.
+// Returns false when the body does not carry exactly one fixture of that shape;
+// callers should then rebuild with destroy_all_fixtures + add_*_fixture.
+bool ame_physics_update_box_fixture(b2Body* body, float width, float height, bool is_sensor);
+bool ame_physics_update_circle_fixture(b2Body* body, float radius, bool is_sensor);
+
 #ifdef __cplusplus
 }
 #endif
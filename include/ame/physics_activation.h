@@ -0,0 +1,72 @@
+#ifndef AME_PHYSICS_ACTIVATION_H
+#define AME_PHYSICS_ACTIVATION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "ame/physics.h"
+#include "ame/camera.h"
+
+// Region-based activation for large worlds.
+// Registered bodies outside every focus region are disabled (b2Body::SetEnabled(false)): they leave
+// the broadphase and the solver but keep position, velocity and sleep state, and are re-enabled
+// unchanged when a focus comes back. Tilemap colliders can be streamed per chunk instead of one
+// body per tile. Call ame_physics_activation_update between steps, e.g. once per frame.
+
+// World-space focus rectangle (Y-up)
+typedef struct AmePhysicsFocus {
+    float min_x, min_y;
+    float max_x, max_y;
+} AmePhysicsFocus;
+
+// Focus around a point (player, AI director, audio listener)
+AmePhysicsFocus ame_physics_focus_around(float x, float y, float half_w, float half_h);
+
+// Focus covering what the camera shows (target-centered, viewport / zoom), grown by margin on each side
+AmePhysicsFocus ame_physics_focus_from_camera(const AmeCamera* cam, float margin);
+
+typedef struct AmePhysicsActivationConfig {
+    float enter_margin;   // activate bodies/chunks within this distance of a focus
+    float exit_margin;    // deactivate only beyond this distance (>= enter_margin; hysteresis)
+} AmePhysicsActivationConfig;
+
+// Defaults: enter 64, exit 128 world units
+void ame_physics_activation_configure(AmePhysicsWorld* world, const AmePhysicsActivationConfig* cfg);
+
+// Re-evaluate every registered body and tile chunk against the foci. count == 0 re-enables everything.
+void ame_physics_activation_update(AmePhysicsWorld* world, const AmePhysicsFocus* foci, size_t count);
+
+// Opt a body out of region parking (e.g. players, scripted movers); re-enables it if parked
+void ame_physics_body_set_always_active(AmePhysicsWorld* world, AmeBodyHandle handle, bool always_active);
+
+// False when the body is currently parked by the activation manager or held (or the handle is stale)
+bool ame_physics_body_is_active(const AmePhysicsWorld* world, AmeBodyHandle handle);
+
+// Park a body on behalf of its owner (entity pools): a held body stays disabled whatever the foci
+// say and keeps its fixtures. Unholding hands it back to the activation manager and refreshes its
+// cached pose, so a body teleported while held is written back from its new place. No-op in a step.
+void ame_physics_body_set_held(AmePhysicsWorld* world, AmeBodyHandle handle, bool held);
+
+// ---- Chunked tilemap colliders ----
+// Tiles (row-major, row 0 at the bottom, non-zero = solid) are split into chunk_tiles x chunk_tiles
+// chunks. Each chunk becomes one static body with merged box fixtures, created when a focus comes
+// near and destroyed when all foci leave. The tile data is copied. The set is owned by the world and
+// destroyed with it unless ame_physics_tile_chunks_destroy is called first.
+typedef struct AmeTileChunkColliders AmeTileChunkColliders;
+
+AmeTileChunkColliders* ame_physics_tile_chunks_create(AmePhysicsWorld* world,
+                                                      const int* tiles, int width, int height,
+                                                      float tile_size, int chunk_tiles);
+void ame_physics_tile_chunks_destroy(AmeTileChunkColliders* chunks);
+
+// Number of chunks whose colliders currently exist
+size_t ame_physics_tile_chunks_loaded(const AmeTileChunkColliders* chunks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AME_PHYSICS_ACTIVATION_H
@@ -0,0 +1,54 @@
+#ifndef AME_PROFILER_H
+#define AME_PROFILER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Frame profiler: begin/end spans recorded into per-thread ring buffers and exported as Chrome
+// trace JSON (chrome://tracing, ui.perfetto.dev).
+// Recording is off by default. While off, a span costs one relaxed atomic load and a thread-local
+// update, so the calls stay compiled into release builds. Each thread appends only to its own ring
+// (no locks after the thread's first span); a full ring overwrites its oldest events.
+// Span names are stored by pointer and must outlive the dump (literals, Flecs system names).
+//
+// Instrumented: ame_ecs_world_progress (and each Flecs system when Flecs is built with
+// FLECS_PERF_TRACE), ame_rp_run_ecs passes, physics steps and audio source syncs.
+
+void ame_profiler_set_enabled(bool enabled);
+bool ame_profiler_enabled(void);
+
+// Spans nest per thread. An end only records when its begin was recorded, so toggling in the
+// middle of a frame never leaves unmatched events behind.
+void ame_profiler_begin(const char* name);
+void ame_profiler_end(void);
+
+// Label the calling thread in the trace (copied); unnamed threads show as "thread N"
+void ame_profiler_set_thread_name(const char* name);
+
+// Drop everything recorded so far
+void ame_profiler_clear(void);
+
+// Events currently held across all rings
+size_t ame_profiler_event_count(void);
+
+// Write the recorded events as Chrome trace JSON. Pause recording first for an exact dump; while
+// recording, events overwritten during the copy are skipped. Returns false on I/O failure.
+bool ame_profiler_write_chrome_trace(const char* path);
+
+#ifdef __cplusplus
+}
+
+// Span for the enclosing C++ scope
+struct AmeProfileScope {
+    explicit AmeProfileScope(const char* name) { ame_profiler_begin(name); }
+    ~AmeProfileScope() { ame_profiler_end(); }
+    AmeProfileScope(const AmeProfileScope&) = delete;
+    AmeProfileScope& operator=(const AmeProfileScope&) = delete;
+};
+#endif
+
+#endif // AME_PROFILER_H
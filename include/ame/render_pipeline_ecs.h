@@ -1,10 +1,46 @@
 #pragma once
+#include <stddef.h>
+#include <stdint.h>
 #ifdef __cplusplus
 extern "C" {
 #endif
 struct ecs_world_t;
+
+// Extract and draw in one call (single-threaded path)
 void ame_rp_run_ecs(struct ecs_world_t* w);
+
+// Split path for a logic thread and a render thread. The logic thread calls ame_rp_extract
+// after each progress; it copies sprites, meshes, tile layers, the camera and text into a
+// snapshot and publishes it without GL calls. The render thread calls ame_rp_acquire_latest
+// and draws the result. Three snapshots rotate, so neither thread ever waits: the renderer
+// skips snapshots it was too slow for and redraws the last one when no new one arrived.
+typedef struct AmeRenderSnapshot AmeRenderSnapshot;
+typedef struct AmeRenderExchange AmeRenderExchange;
+
+// Text entry of a snapshot; text points into the snapshot and lives as long as it does
+typedef struct AmeRenderText {
+    float x, y;          // world position
+    uint32_t font;
+    float r, g, b, a;
+    float size;
+    int wrap_px;
+    const char* text;
+} AmeRenderText;
+
+AmeRenderExchange* ame_rp_exchange_create(void);
+void ame_rp_exchange_destroy(AmeRenderExchange* x);
+
+// Logic thread only (one extractor per exchange)
+void ame_rp_extract(struct ecs_world_t* w, AmeRenderExchange* x);
+
+// Render thread only. Never blocks; NULL until the first extract. The snapshot stays valid
+// until the next call.
+const AmeRenderSnapshot* ame_rp_acquire_latest(AmeRenderExchange* x);
+void ame_rp_draw_snapshot(const AmeRenderSnapshot* s);
+// Increments with every extract; equal ticks mean the same world state
+uint64_t ame_rp_snapshot_tick(const AmeRenderSnapshot* s);
+size_t ame_rp_snapshot_texts(const AmeRenderSnapshot* s, const AmeRenderText** out);
+
 #ifdef __cplusplus
 }
 #endif
-
@@ -6,6 +6,9 @@ extern "C" {
 #endif
 
 // This header must be usable when Flecs is disabled. Only include flecs when enabled.
+#include <stdbool.h>
+#include <stddef.h>
+
 #if AME_WITH_FLECS
 #include <flecs.h>
 #else
@@ -13,11 +16,28 @@ extern "C" {
 typedef struct ecs_world_t ecs_world_t;
 #endif
 
-// Register the text systems with the ECS world.
+// Register the text systems with the ECS world and create its text arena.
+// Text.text_ptr points into the arena; strings are released when replaced or when Text is removed.
 // Systems:
-//  - SysTextApplyRequests: copies Text.request_buf to a heap string at Text.text_ptr when request_set!=0
+//  - SysTextApplyRequests (PreStore): applies queued ame_text_request strings, last request wins
+//  - SysTextRelease (OnRemove observer): returns the string of a removed Text to the arena
 void ame_text_system_register(ecs_world_t* w);
 
+#if AME_WITH_FLECS
+// Queue new text for an entity's Text component. The string is copied into the arena's pending
+// buffer, so Text itself carries no request bytes. Safe from any thread and from inside systems.
+bool ame_text_request(ecs_world_t* w, ecs_entity_t e, const char* s, size_t len);
+
+// Apply queued requests now (thread that progresses the world). Returns how many were applied.
+size_t ame_text_apply_requests(ecs_world_t* w);
+
+// Copy a string into the arena for direct assignment to Text.text_ptr (e.g. when loading).
+// World thread only.
+const char* ame_text_store(ecs_world_t* w, const char* s, size_t len);
+// Give back a string from ame_text_store that was never assigned to a Text. World thread only.
+void ame_text_release(ecs_world_t* w, const char* s);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,77 @@
+#ifndef AME_TILE_CONTROLLER_H
+#define AME_TILE_CONTROLLER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "ame/tilemap.h"
+#include "ame/physics.h"   // AmeTransform2D
+
+// Kinematic character controller that collides axis-aligned boxes directly against tile layer data.
+// No Box2D bodies, raycasts or solver: movers are swept per axis through the grid each tick.
+// Coordinates follow ame/coords.h: Y-up, row 0 at the bottom, positions are box centers.
+
+// Collision shape of a tile, looked up per gid
+typedef enum AmeTileShape {
+    AME_TILE_EMPTY = 0,
+    AME_TILE_SOLID = 1,
+    AME_TILE_ONE_WAY = 2,          // blocks only from above while falling
+    AME_TILE_SLOPE_UP_RIGHT = 3,   // 45-degree floor rising from the left edge to the right edge
+    AME_TILE_SLOPE_UP_LEFT = 4     // 45-degree floor rising from the right edge to the left edge
+} AmeTileShape;
+
+typedef struct AmeTileGrid {
+    const int32_t* data;       // row-major gids, row 0 = bottom (as produced by the TMX loader)
+    int width, height;         // tiles
+    float tile_w, tile_h;      // world units per tile
+    float origin_x, origin_y;  // world position of the bottom-left corner of tile (0,0)
+    const uint8_t* shapes;     // AmeTileShape per gid (index = gid); NULL = every non-zero gid is solid
+    size_t shape_count;        // gids >= shape_count are treated as empty
+} AmeTileGrid;
+
+// Output flags, rewritten by every move
+#define AME_TILE_HIT_GROUND     (1u << 0)
+#define AME_TILE_HIT_CEILING    (1u << 1)
+#define AME_TILE_HIT_WALL_LEFT  (1u << 2)
+#define AME_TILE_HIT_WALL_RIGHT (1u << 3)
+#define AME_TILE_ON_SLOPE       (1u << 4)
+#define AME_TILE_ON_ONE_WAY     (1u << 5)
+
+// Input options
+#define AME_TILE_MOVER_DROP_THROUGH (1u << 0)  // ignore one-way platforms this tick
+
+typedef struct AmeTileMover {
+    float x, y;            // box center (world)
+    float half_w, half_h;
+    float vx, vy;          // units per second; zeroed on the blocked axis
+    float step_height;     // ledge height a grounded mover may step onto (0 = none)
+    uint32_t options;      // AME_TILE_MOVER_*
+    uint32_t flags;        // AME_TILE_HIT_* / AME_TILE_ON_* from the last move (also read as "was grounded")
+} AmeTileMover;
+
+// Grid over a loaded layer; shapes/shape_count may be NULL/0 for "non-zero = solid"
+void ame_tile_grid_from_layer(AmeTileGrid* g, const AmeTilemapLayer* layer,
+                              float tile_w, float tile_h,
+                              const uint8_t* shapes, size_t shape_count);
+
+// Shape of tile (col,row); out-of-range tiles are empty
+AmeTileShape ame_tile_grid_shape_at(const AmeTileGrid* g, int col, int row);
+
+// Advance one mover by its velocity over dt seconds (horizontal pass, then vertical pass)
+void ame_tile_move(const AmeTileGrid* g, AmeTileMover* m, float dt);
+
+// Advance many movers against the same grid (movers are independent; order does not matter)
+void ame_tile_move_batch(const AmeTileGrid* g, AmeTileMover* movers, size_t count, float dt);
+
+// Copy mover centers into transforms (angle untouched) for the sprite/physics sync pipeline
+void ame_tile_movers_write_transforms(const AmeTileMover* movers, size_t count, AmeTransform2D* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AME_TILE_CONTROLLER_H
@@ -1,5 +1,6 @@
 #include "ame/audio.h"
 #include "ame/ecs.h"
+#include "ame/profiler.h"
 
 #if AME_WITH_FLECS
 #include <flecs.h>
@@ -653,7 +654,9 @@ AmeEcsId ame_audio_register_component(AmeEcsWorld *ew) {
 #endif
 
 void ame_audio_sync_sources_refs(const struct AmeAudioSourceRef *refs, size_t count) {
+    ame_profiler_begin("audio.sync");
     mixer_set_active_refs(refs, count);
+    ame_profiler_end();
 }
 
 void ame_audio_sync_sources_manual(struct AmeAudioSource **sources, size_t count) {
@@ -666,6 +669,8 @@ void ame_audio_sync_sources_manual(struct AmeAudioSource **sources, size_t count
         refs[i].src = sources[i];
         refs[i].stable_id = (uint64_t)(uintptr_t)sources[i];
     }
+    ame_profiler_begin("audio.sync");
     mixer_set_active_refs(refs, count);
+    ame_profiler_end();
     if (heap_used) free(refs);
 }
@@ -1,62 +1,64 @@
 #include <flecs.h>
 #include "ame/collider2d_system.h"
-#include <math.h>
-#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// The apply callbacks are OnSet observers on (collider, AmePhysicsBody): they run when either
+// component is set, so nothing is scanned on idle frames. A collider set before its body exists
+// keeps dirty=1 and is applied once the body is set. Observer ctx carries the AmeTransform2D id.
+// Collider2D may be inherited from a prefab (IsA); each instance still owns its body.
+
+static ecs_entity_t transform_id(const ecs_iter_t* it) {
+    return (ecs_entity_t)(uintptr_t)it->ctx;
+}
+
+static void apply_body_angle(ecs_iter_t* it, int i, b2Body* body) {
+    ecs_entity_t TransformId = transform_id(it);
+    if (!TransformId) return;
+    const AmeTransform2D* tr = (const AmeTransform2D*)ecs_get_id(it->world, it->entities[i], TransformId);
+    if (tr) { ame_physics_set_angle(body, tr->angle); }
+}
 
 static void SysCollider2DApply(ecs_iter_t* it) {
-    Col2D* c = ecs_field(it, Col2D, 0);
+    Col2D* cols = ecs_field(it, Col2D, 0);
     AmePhysicsBody* pb = ecs_field(it, AmePhysicsBody, 1);
+    // A shared collider's dirty flag can't tell which instances are fitted: apply on every event
+    bool c_self = ecs_field_is_self(it, 0);
     for (int i = 0; i < it->count; ++i) {
-        if (!pb || !pb[i].body) continue;
-        if (c[i].dirty) {
-            pb[i].is_sensor = c[i].isTrigger != 0;
-            ame_physics_destroy_all_fixtures(pb[i].body);
-            if (c[i].type == 0) {
-                float w = c[i].w > 0 ? c[i].w : pb[i].width;
-                float h = c[i].h > 0 ? c[i].h : pb[i].height;
-                float bx = 0, by = 0; ame_physics_get_position(pb[i].body, &bx, &by);
-                float hw = w * 0.5f, hh = h * 0.5f;
-                float verts[12] = {
-                    bx - hw, by - hh,  bx + hw, by - hh,  bx + hw, by + hh,
-                    bx - hw, by - hh,  bx + hw, by + hh,  bx - hw, by + hh
-                };
-                ame_physics_add_mesh_triangles_world(pb[i].body, verts, 2, pb[i].is_sensor, 0.0f, 0.3f);
-            } else if (c[i].type == 1) {
-                float r = c[i].radius > 0 ? c[i].radius : (pb[i].width > pb[i].height ? pb[i].width : pb[i].height) * 0.5f;
-                float bx = 0, by = 0; ame_physics_get_position(pb[i].body, &bx, &by);
-                enum {N = 8};
-                float verts[6 * N];
-                for (int k = 0; k < N; ++k) {
-                    float a0 = (float)k * (6.28318530718f / N);
-                    float a1 = (float)(k+1) * (6.28318530718f / N);
-                    verts[k*6 + 0] = bx;
-                    verts[k*6 + 1] = by;
-                    verts[k*6 + 2] = bx + r * cosf(a0);
-                    verts[k*6 + 3] = by + r * sinf(a0);
-                    verts[k*6 + 4] = bx + r * cosf(a1);
-                    verts[k*6 + 5] = by + r * sinf(a1);
-                }
-                ame_physics_add_mesh_triangles_world(pb[i].body, verts, (size_t)N, pb[i].is_sensor, 0.0f, 0.3f);
+        if (!pb[i].body) continue;
+        Col2D* c = &cols[c_self ? i : 0];
+        if (c_self && !c->dirty) continue;
+        bool sensor = c->isTrigger != 0;
+        pb[i].is_sensor = sensor;
+        if (c->type == 0) {
+            float w = c->w > 0 ? c->w : pb[i].width;
+            float h = c->h > 0 ? c->h : pb[i].height;
+            // Size/trigger edits keep the existing fixture (and its contacts' proxy)
+            if (!ame_physics_update_box_fixture(pb[i].body, w, h, sensor)) {
+                ame_physics_destroy_all_fixtures(pb[i].body);
+                ame_physics_add_box_fixture(pb[i].body, w, h, sensor, 0.0f, 0.3f);
+            }
+        } else if (c->type == 1) {
+            float r = c->radius > 0 ? c->radius : (pb[i].width > pb[i].height ? pb[i].width : pb[i].height) * 0.5f;
+            if (!ame_physics_update_circle_fixture(pb[i].body, r, sensor)) {
+                ame_physics_destroy_all_fixtures(pb[i].body);
+                ame_physics_add_circle_fixture(pb[i].body, r, sensor, 0.0f, 0.3f);
             }
-            c[i].dirty = 0;
         }
+        if (c_self) c->dirty = 0;
     }
 }
 
 static void SysEdgeCollider2DApply(ecs_iter_t* it){
     EdgeCol2D* ec = ecs_field(it, EdgeCol2D, 0);
     AmePhysicsBody* pb = ecs_field(it, AmePhysicsBody, 1);
-    ecs_entity_t TransformId = ecs_lookup(it->world, "AmeTransform2D");
     for (int i=0;i<it->count;i++){
-        if (!ec || !pb) continue;
         if (!pb[i].body) continue;
         if (!ec[i].dirty) continue;
         ame_physics_destroy_all_fixtures(pb[i].body);
         ame_physics_add_edge_fixture_world(pb[i].body, ec[i].x1, ec[i].y1, ec[i].x2, ec[i].y2, ec[i].isTrigger != 0, 0.0f, 0.3f);
-        if (TransformId) {
-            AmeTransform2D* tr = (AmeTransform2D*)ecs_get_id(it->world, it->entities[i], TransformId);
-            if (tr) { ame_physics_set_angle(pb[i].body, tr->angle); }
-        }
+        apply_body_angle(it, i, pb[i].body);
         ec[i].dirty = 0;
     }
 }
@@ -64,17 +66,12 @@ static void SysEdgeCollider2DApply(ecs_iter_t* it){
 static void SysChainCollider2DApply(ecs_iter_t* it){
     ChainCol2D* ch = ecs_field(it, ChainCol2D, 0);
     AmePhysicsBody* pb = ecs_field(it, AmePhysicsBody, 1);
-    ecs_entity_t TransformId = ecs_lookup(it->world, "AmeTransform2D");
     for (int i=0;i<it->count;i++){
-        if (!ch || !pb) continue;
         if (!pb[i].body) continue;
         if (!ch[i].dirty || ch[i].count < 2) continue;
         ame_physics_destroy_all_fixtures(pb[i].body);
         ame_physics_add_chain_fixture_world(pb[i].body, ch[i].points, ch[i].count, ch[i].isLoop != 0, ch[i].isTrigger != 0, 0.0f, 0.3f);
-        if (TransformId) {
-            AmeTransform2D* tr = (AmeTransform2D*)ecs_get_id(it->world, it->entities[i], TransformId);
-            if (tr) { ame_physics_set_angle(pb[i].body, tr->angle); }
-        }
+        apply_body_angle(it, i, pb[i].body);
         ch[i].dirty = 0;
     }
 }
@@ -82,152 +79,166 @@ static void SysChainCollider2DApply(ecs_iter_t* it){
 static void SysMeshCollider2DApply(ecs_iter_t* it){
     MeshCol2D* mc = ecs_field(it, MeshCol2D, 0);
     AmePhysicsBody* pb = ecs_field(it, AmePhysicsBody, 1);
-    ecs_entity_t TransformId = ecs_lookup(it->world, "AmeTransform2D");
-    fprintf(stderr, "[MeshCollider] System called with %d entities\n", it->count);
     for (int i=0;i<it->count;i++){
-        fprintf(stderr, "[MeshCollider] Entity %llu: mc=%p pb=%p\n", (unsigned long long)it->entities[i], (void*)mc, (void*)pb);
-        if (mc) fprintf(stderr, "[MeshCollider]   mc[%d]: dirty=%d count=%zu\n", i, mc[i].dirty, mc[i].count);
-        if (pb) fprintf(stderr, "[MeshCollider]   pb[%d]: body=%p\n", i, (void*)pb[i].body);
-        if (!mc || !pb) continue;
         if (!pb[i].body) continue;
         if (!mc[i].dirty || mc[i].count < 3) continue;
-        fprintf(stderr, "[MeshCollider] Processing entity %llu with %zu vertices\n", (unsigned long long)it->entities[i], mc[i].count);
         ame_physics_destroy_all_fixtures(pb[i].body);
         size_t tri_count = mc[i].count / 3;
-        ame_physics_add_mesh_triangles_world(pb[i].body, mc[i].vertices, tri_count, mc[i].isTrigger != 0, 0.0f, 0.3f);
-        if (TransformId) {
-            AmeTransform2D* tr = (AmeTransform2D*)ecs_get_id(it->world, it->entities[i], TransformId);
-            if (tr) { ame_physics_set_angle(pb[i].body, tr->angle); }
+        if (!mc[i].decomp) {
+            AmeConvexDecomp* d = (AmeConvexDecomp*)calloc(1, sizeof(AmeConvexDecomp));
+            if (d && ame_convex_decompose_triangles(mc[i].vertices, tri_count, AME_DECOMP_MAX_POLY_VERTS, d)) mc[i].decomp = d;
+            else free(d);
         }
+        if (mc[i].decomp) {
+            const AmeConvexDecomp* d = mc[i].decomp;
+            ame_physics_add_convex_polygons_world(pb[i].body, d->verts, d->offsets, d->poly_count, mc[i].isTrigger != 0, 0.0f, 0.3f);
+        } else {
+            ame_physics_add_mesh_triangles_world(pb[i].body, mc[i].vertices, tri_count, mc[i].isTrigger != 0, 0.0f, 0.3f);
+        }
+        apply_body_angle(it, i, pb[i].body);
         mc[i].dirty = 0;
-        fprintf(stderr, "[MeshCollider] Finished processing entity %llu\n", (unsigned long long)it->entities[i]);
     }
 }
 
-// Simple verification system to test MeshCollider2D query
-static void VerifyMeshColliderQuery(ecs_iter_t* it) {
-    fprintf(stderr, "[VERIFY] MeshCollider query found %d entities\n", it->count);
-    for (int i = 0; i < it->count; i++) {
-        fprintf(stderr, "[VERIFY] Entity %llu in MeshCollider query\n", (unsigned long long)it->entities[i]);
+// Read-only on the physics side: pose cache lookups by handle, b2Body getters otherwise
+static void SysPhysicsWriteback(ecs_iter_t* it) {
+    const AmePhysicsBody* pb = ecs_field(it, AmePhysicsBody, 0);
+    AmeTransform2D* tr = ecs_field(it, AmeTransform2D, 1);
+    const AmePhysicsWorld* physics = (const AmePhysicsWorld*)it->ctx;
+    for (int i = 0; i < it->count; ++i) {
+        if (pb[i].handle && ame_physics_body_pose(physics, pb[i].handle, &tr[i], NULL, NULL)) continue;
+        if (!pb[i].body) continue;
+        ame_physics_get_position(pb[i].body, &tr[i].x, &tr[i].y);
+        tr[i].angle = ame_physics_get_angle(pb[i].body);
     }
 }
 
-void ame_collider2d_system_register(ecs_world_t* w) {
-    ecs_entity_t ColId = ecs_lookup(w, "Collider2D");
-    if (!ColId) {
-        ecs_component_desc_t cdp = (ecs_component_desc_t){0};
-        ecs_entity_desc_t edp = {0}; edp.name = "Collider2D";
-        cdp.entity = ecs_entity_init(w, &edp);
-        cdp.type.size = (int32_t)sizeof(Col2D);
-        cdp.type.alignment = (int32_t)_Alignof(Col2D);
-        ColId = ecs_component_init(w, &cdp);
+static ecs_entity_t ensure_component(ecs_world_t* w, const char* name, int32_t size, int32_t alignment) {
+    ecs_entity_t id = ecs_lookup(w, name);
+    if (id) return id;
+    ecs_component_desc_t cdp = (ecs_component_desc_t){0};
+    ecs_entity_desc_t edp = {0}; edp.name = name;
+    cdp.entity = ecs_entity_init(w, &edp);
+    cdp.type.size = size;
+    cdp.type.alignment = alignment;
+    return ecs_component_init(w, &cdp);
+}
+
+static void mesh_col_drop_cache(MeshCol2D* m) {
+    if (!m->decomp) return;
+    ame_convex_decomp_free(m->decomp);
+    free(m->decomp);
+    m->decomp = NULL;
+}
+
+static void MeshCol2DDtor(void* ptr, int32_t count, const ecs_type_info_t* ti) {
+    (void)ti;
+    MeshCol2D* m = (MeshCol2D*)ptr;
+    for (int32_t i = 0; i < count; ++i) mesh_col_drop_cache(&m[i]);
+}
+
+// Copies rebuild their own cache on the next apply
+static void MeshCol2DCopy(void* dst_ptr, const void* src_ptr, int32_t count, const ecs_type_info_t* ti) {
+    (void)ti;
+    MeshCol2D* dst = (MeshCol2D*)dst_ptr;
+    const MeshCol2D* src = (const MeshCol2D*)src_ptr;
+    for (int32_t i = 0; i < count; ++i) {
+        if (dst[i].decomp != src[i].decomp) mesh_col_drop_cache(&dst[i]);
+        dst[i] = src[i];
+        dst[i].decomp = NULL;
+        dst[i].dirty = 1;
     }
-    ecs_entity_t BodyId = ecs_lookup(w, "AmePhysicsBody");
-    if (!BodyId) {
-        ecs_component_desc_t cdp = (ecs_component_desc_t){0};
-        ecs_entity_desc_t edp = {0}; edp.name = "AmePhysicsBody";
-        cdp.entity = ecs_entity_init(w, &edp);
-        cdp.type.size = (int32_t)sizeof(AmePhysicsBody);
-        cdp.type.alignment = (int32_t)_Alignof(AmePhysicsBody);
-        BodyId = ecs_component_init(w, &cdp);
+}
+
+static void MeshCol2DMove(void* dst_ptr, void* src_ptr, int32_t count, const ecs_type_info_t* ti) {
+    (void)ti;
+    MeshCol2D* dst = (MeshCol2D*)dst_ptr;
+    MeshCol2D* src = (MeshCol2D*)src_ptr;
+    for (int32_t i = 0; i < count; ++i) {
+        if (dst[i].decomp != src[i].decomp) mesh_col_drop_cache(&dst[i]);
+        dst[i] = src[i];
+        src[i].decomp = NULL;
     }
+}
 
-    // Base collider system
-    ecs_system_desc_t sd = {0};
-    sd.entity = ecs_entity_init(w, &(ecs_entity_desc_t){ .name = "SysCollider2DApply", .add = (ecs_id_t[]){ ecs_pair(EcsDependsOn, EcsOnUpdate), 0 } });
-    sd.callback = SysCollider2DApply;
-    sd.query.terms[0].id = ColId;
-    sd.query.terms[1].id = BodyId;
-    // Exclude entities that also have specialized collider components to avoid overriding them
-    // Note: add these Not-terms only if the component IDs exist
-    {
-        int ti = 2;
-        ecs_entity_t EdgeIdT = ecs_lookup(w, "EdgeCollider2D");
-        ecs_entity_t ChainIdT = ecs_lookup(w, "ChainCollider2D");
-        ecs_entity_t MeshIdT = ecs_lookup(w, "MeshCollider2D");
-        if (EdgeIdT) { sd.query.terms[ti].id = EdgeIdT; sd.query.terms[ti].oper = EcsNot; ti++; }
-        if (ChainIdT) { sd.query.terms[ti].id = ChainIdT; sd.query.terms[ti].oper = EcsNot; ti++; }
-        if (MeshIdT) { sd.query.terms[ti].id = MeshIdT; sd.query.terms[ti].oper = EcsNot; ti++; }
+// The name may already be registered without the hooks (by an importer or a plain
+// ECS_COMPONENT), so the hooks and the trait are checked rather than trusted to come with it
+ecs_entity_t ame_mesh_collider2d_component(ecs_world_t* w) {
+    ecs_entity_t id = ensure_component(w, "MeshCollider2D", (int32_t)sizeof(MeshCol2D), (int32_t)_Alignof(MeshCol2D));
+    const ecs_type_info_t* ti = ecs_get_type_info(w, id);
+    if (ti && !ti->hooks.copy) {
+        ecs_type_hooks_t hooks = {0};
+        hooks.dtor = MeshCol2DDtor;
+        hooks.copy = MeshCol2DCopy;
+        hooks.move = MeshCol2DMove;
+        ecs_set_hooks_id(w, id, &hooks);
     }
+    // The cache is per owner and the fixtures per body: prefab instances get neither
+    if (!ecs_has_pair(w, id, EcsOnInstantiate, EcsDontInherit)) ecs_add_pair(w, id, EcsOnInstantiate, EcsDontInherit);
+    return id;
+}
+
+// Fills the (collider, body) terms and OnSet event; replaces a previous registration of `name`.
+// yield_existing applies colliders that were set before registration.
+static void register_apply_observer(ecs_world_t* w, const char* name, ecs_entity_t collider, ecs_entity_t body,
+                                    void* ctx, ecs_observer_desc_t* od) {
+    ecs_entity_t existing = ecs_lookup(w, name);
+    if (existing) { ecs_delete(w, existing); }
+    od->entity = ecs_entity_init(w, &(ecs_entity_desc_t){ .name = name });
+    od->query.terms[0].id = collider;
+    od->query.terms[1].id = body;
+    od->events[0] = EcsOnSet;
+    od->yield_existing = true;
+    od->ctx = ctx;
+    ecs_observer_init(w, od);
+}
+
+void ame_physics_writeback_system_register(ecs_world_t* w, AmePhysicsWorld* physics) {
+    if (!w || !physics) return;
+    ecs_entity_t BodyId = ensure_component(w, "AmePhysicsBody", (int32_t)sizeof(AmePhysicsBody), (int32_t)_Alignof(AmePhysicsBody));
+    ecs_entity_t TransformId = ensure_component(w, "AmeTransform2D", (int32_t)sizeof(AmeTransform2D), (int32_t)_Alignof(AmeTransform2D));
+
+    ecs_system_desc_t sd = {0};
+    sd.entity = ecs_entity_init(w, &(ecs_entity_desc_t){ .name = "SysPhysicsWriteback", .add = (ecs_id_t[]){ ecs_pair(EcsDependsOn, EcsPostUpdate), 0 } });
+    sd.callback = SysPhysicsWriteback;
+    sd.ctx = physics;
+    sd.query.terms[0].id = BodyId;      sd.query.terms[0].inout = EcsIn;
+    sd.query.terms[1].id = TransformId; sd.query.terms[1].inout = EcsOut;
+    sd.multi_threaded = true;
     ecs_system_init(w, &sd);
+}
 
-    // Extras types registration and systems
-    ecs_entity_t EdgeId = ecs_lookup(w, "EdgeCollider2D");
-    ecs_entity_t ChainId = ecs_lookup(w, "ChainCollider2D");
-    ecs_entity_t MeshId = ecs_lookup(w, "MeshCollider2D");
-
-    if (!EdgeId) {
-        ecs_component_desc_t cdp = (ecs_component_desc_t){0};
-        ecs_entity_desc_t edp = {0}; edp.name = "EdgeCollider2D";
-        cdp.entity = ecs_entity_init(w, &edp);
-        cdp.type.size = (int32_t)sizeof(EdgeCol2D);
-        cdp.type.alignment = (int32_t)_Alignof(EdgeCol2D);
-        EdgeId = ecs_component_init(w, &cdp);
-    }
-    if (!ChainId) {
-        ecs_component_desc_t cdp = (ecs_component_desc_t){0};
-        ecs_entity_desc_t edp = {0}; edp.name = "ChainCollider2D";
-        cdp.entity = ecs_entity_init(w, &edp);
-        cdp.type.size = (int32_t)sizeof(ChainCol2D);
-        cdp.type.alignment = (int32_t)_Alignof(ChainCol2D);
-        ChainId = ecs_component_init(w, &cdp);
-    }
-    if (!MeshId) {
-        ecs_component_desc_t cdp = (ecs_component_desc_t){0};
-        ecs_entity_desc_t edp = {0}; edp.name = "MeshCollider2D";
-        cdp.entity = ecs_entity_init(w, &edp);
-        cdp.type.size = (int32_t)sizeof(MeshCol2D);
-        cdp.type.alignment = (int32_t)_Alignof(MeshCol2D);
-        MeshId = ecs_component_init(w, &cdp);
-    }
+void ame_collider2d_system_register(ecs_world_t* w) {
+    // Resolve every id once; the Not terms below need the specialized collider ids to exist
+    ecs_entity_t ColId = ensure_component(w, "Collider2D", (int32_t)sizeof(Col2D), (int32_t)_Alignof(Col2D));
+    ecs_entity_t BodyId = ensure_component(w, "AmePhysicsBody", (int32_t)sizeof(AmePhysicsBody), (int32_t)_Alignof(AmePhysicsBody));
+    ecs_entity_t EdgeId = ensure_component(w, "EdgeCollider2D", (int32_t)sizeof(EdgeCol2D), (int32_t)_Alignof(EdgeCol2D));
+    ecs_entity_t ChainId = ensure_component(w, "ChainCollider2D", (int32_t)sizeof(ChainCol2D), (int32_t)_Alignof(ChainCol2D));
+    ecs_entity_t MeshId = ame_mesh_collider2d_component(w);
+    // Registered here when the colliders come first (the angle fixup reads it through ctx)
+    ecs_entity_t TransformId = ensure_component(w, "AmeTransform2D", (int32_t)sizeof(AmeTransform2D), (int32_t)_Alignof(AmeTransform2D));
+    void* ctx = (void*)(uintptr_t)TransformId;
+    // Prefab instances share the collider shape but never the body; before the observers exist
+    ecs_add_pair(w, ColId, EcsOnInstantiate, EcsInherit);
+    ecs_add_pair(w, BodyId, EcsOnInstantiate, EcsDontInherit);
 
-    if (EdgeId){
-        ecs_system_desc_t sde = (ecs_system_desc_t){0};
-        ecs_entity_desc_t ed = {0}; ed.name = "SysEdgeCollider2DApply"; ed.add = (ecs_id_t[]){ ecs_pair(EcsDependsOn, EcsOnUpdate), 0 };
-        sde.entity = ecs_entity_init(w, &ed);
-        sde.callback = SysEdgeCollider2DApply;
-        sde.query.terms[0].id = EdgeId;
-        sde.query.terms[1].id = BodyId;
-        ecs_system_init(w, &sde);
-    }
-    if (ChainId){
-        ecs_system_desc_t sdc = (ecs_system_desc_t){0};
-        ecs_entity_desc_t ed = {0}; ed.name = "SysChainCollider2DApply"; ed.add = (ecs_id_t[]){ ecs_pair(EcsDependsOn, EcsOnUpdate), 0 };
-        sdc.entity = ecs_entity_init(w, &ed);
-        sdc.callback = SysChainCollider2DApply;
-        sdc.query.terms[0].id = ChainId;
-        sdc.query.terms[1].id = BodyId;
-        ecs_system_init(w, &sdc);
-    }
-    if (MeshId){
-        fprintf(stderr, "[collider2d_system] Registering MeshCollider system with MeshId=%llu BodyId=%llu\n",
-                (unsigned long long)MeshId, (unsigned long long)BodyId);
-        ecs_entity_t existing_sys = ecs_lookup(w, "SysMeshCollider2DApply");
-        if (existing_sys) { 
-            fprintf(stderr, "[collider2d_system] Deleting existing MeshCollider system %llu\n", (unsigned long long)existing_sys);
-            ecs_delete(w, existing_sys); 
-        }
-        ecs_system_desc_t sdm = (ecs_system_desc_t){0};
-        ecs_entity_desc_t ed = {0}; ed.name = "SysMeshCollider2DApply"; ed.add = (ecs_id_t[]){ ecs_pair(EcsDependsOn, EcsOnUpdate), 0 };
-        sdm.entity = ecs_entity_init(w, &ed);
-        sdm.callback = SysMeshCollider2DApply;
-        sdm.query.terms[0].id = MeshId;
-        sdm.query.terms[1].id = BodyId;
-        ecs_entity_t sys_id = ecs_system_init(w, &sdm);
-        fprintf(stderr, "[collider2d_system] MeshCollider system registered with ID=%llu\n", (unsigned long long)sys_id);
-        // Debug: verify system tag
-        fprintf(stderr, "[collider2d_system] SysMeshCollider2DApply has EcsSystem: %s\n", 
-                ecs_has_id(w, sys_id, EcsSystem) ? "YES" : "NO");
-        
-        // Also register verification system to test query
-        ecs_system_desc_t verify_desc = {0};
-        ecs_entity_desc_t verify_ed = {0}; verify_ed.name = "VerifyMeshColliderQuery"; verify_ed.add = (ecs_id_t[]){ ecs_pair(EcsDependsOn, EcsOnUpdate), 0 };
-        verify_desc.entity = ecs_entity_init(w, &verify_ed);
-        verify_desc.callback = VerifyMeshColliderQuery;
-        verify_desc.query.terms[0].id = MeshId;
-        ecs_system_init(w, &verify_desc);
-        fprintf(stderr, "[collider2d_system] Verification system registered\n");
-    } else {
-        fprintf(stderr, "[collider2d_system] MeshCollider2D component not found, skipping system registration\n");
-    }
+    // Base collider; entities with a specialized collider are left to its observer
+    ecs_observer_desc_t od = {0};
+    od.callback = SysCollider2DApply;
+    od.query.terms[2].id = EdgeId;  od.query.terms[2].oper = EcsNot;
+    od.query.terms[3].id = ChainId; od.query.terms[3].oper = EcsNot;
+    od.query.terms[4].id = MeshId;  od.query.terms[4].oper = EcsNot;
+    register_apply_observer(w, "SysCollider2DApply", ColId, BodyId, ctx, &od);
+
+    od = (ecs_observer_desc_t){0};
+    od.callback = SysEdgeCollider2DApply;
+    register_apply_observer(w, "SysEdgeCollider2DApply", EdgeId, BodyId, ctx, &od);
+
+    od = (ecs_observer_desc_t){0};
+    od.callback = SysChainCollider2DApply;
+    register_apply_observer(w, "SysChainCollider2DApply", ChainId, BodyId, ctx, &od);
+
+    od = (ecs_observer_desc_t){0};
+    od.callback = SysMeshCollider2DApply;
+    register_apply_observer(w, "SysMeshCollider2DApply", MeshId, BodyId, ctx, &od);
 }
@@ -0,0 +1,219 @@
+#include "ame/collider_decompose.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Raw polygons may carry collinear vertices while merging; they are stripped on output
+#define DECOMP_RAW_CAP 24
+// |sin(angle)| below this counts as a straight corner
+#define DECOMP_SIN_EPS 1e-5
+
+typedef struct DPoly { int n; int v[DECOMP_RAW_CAP]; } DPoly;
+typedef struct DWeld { double x, y; int src; } DWeld;
+typedef struct DEdgeRec { int lo, hi, tri; } DEdgeRec;
+typedef struct DShared { int a, b, t0, t1; double len2; } DShared;
+
+static int cmp_weld(const void* pa, const void* pb) {
+    const DWeld* a = (const DWeld*)pa; const DWeld* b = (const DWeld*)pb;
+    if (a->x < b->x) return -1;
+    if (a->x > b->x) return 1;
+    if (a->y < b->y) return -1;
+    if (a->y > b->y) return 1;
+    return a->src - b->src;
+}
+
+static int cmp_edge(const void* pa, const void* pb) {
+    const DEdgeRec* a = (const DEdgeRec*)pa; const DEdgeRec* b = (const DEdgeRec*)pb;
+    if (a->lo != b->lo) return a->lo < b->lo ? -1 : 1;
+    if (a->hi != b->hi) return a->hi < b->hi ? -1 : 1;
+    return a->tri - b->tri;
+}
+
+// Longest diagonals first: removing them tends to leave fewer, fatter polygons
+static int cmp_shared(const void* pa, const void* pb) {
+    const DShared* a = (const DShared*)pa; const DShared* b = (const DShared*)pb;
+    if (a->len2 > b->len2) return -1;
+    if (a->len2 < b->len2) return 1;
+    return 0;
+}
+
+static int uf_find(int* parent, int i) {
+    while (parent[i] != i) { parent[i] = parent[parent[i]]; i = parent[i]; }
+    return i;
+}
+
+// Signed sine of the turn at vertex i (positive = left turn for CCW polygons)
+static double corner_sin(const double* px, const double* py, const DPoly* p, int i) {
+    int a = p->v[(i + p->n - 1) % p->n], b = p->v[i], c = p->v[(i + 1) % p->n];
+    double e1x = px[b] - px[a], e1y = py[b] - py[a];
+    double e2x = px[c] - px[b], e2y = py[c] - py[b];
+    double l = sqrt((e1x*e1x + e1y*e1y) * (e2x*e2x + e2y*e2y));
+    if (l <= 0.0) return 0.0;
+    return (e1x*e2y - e1y*e2x) / l;
+}
+
+// Convex (collinear corners allowed) and at most max_verts real corners
+static int poly_ok(const double* px, const double* py, const DPoly* p, int max_verts) {
+    int corners = 0;
+    for (int i = 0; i < p->n; ++i) {
+        for (int j = i + 1; j < p->n; ++j) if (p->v[i] == p->v[j]) return 0;
+        double s = corner_sin(px, py, p, i);
+        if (s < -DECOMP_SIN_EPS) return 0;
+        if (s > DECOMP_SIN_EPS) corners++;
+    }
+    return corners >= 3 && corners <= max_verts;
+}
+
+// Join A and B across their shared edge {a,b}. A holds it as u->w, B (same winding) as w->u.
+static int poly_merge(const DPoly* A, const DPoly* B, int a, int b, DPoly* out) {
+    int ia = -1, ib = -1;
+    for (int i = 0; i < A->n; ++i) {
+        int x = A->v[i], y = A->v[(i + 1) % A->n];
+        if ((x == a && y == b) || (x == b && y == a)) { ia = i; break; }
+    }
+    if (ia < 0) return 0;
+    int u = A->v[ia], w = A->v[(ia + 1) % A->n];
+    for (int i = 0; i < B->n; ++i) {
+        if (B->v[i] == w && B->v[(i + 1) % B->n] == u) { ib = i; break; }
+    }
+    if (ib < 0) return 0;
+    int n = A->n + B->n - 2;
+    if (n > DECOMP_RAW_CAP) return 0;
+    out->n = 0;
+    for (int k = 0; k < A->n; ++k) out->v[out->n++] = A->v[(ia + 1 + k) % A->n]; // w .. u
+    for (int k = 2; k < B->n; ++k) out->v[out->n++] = B->v[(ib + k) % B->n];     // after u .. before w
+    return 1;
+}
+
+bool ame_convex_decompose_triangles(const float* tri_vertices, size_t tri_count,
+                                    int max_poly_verts, AmeConvexDecomp* out) {
+    if (!out) return false;
+    memset(out, 0, sizeof(*out));
+    if (!tri_vertices || tri_count == 0) return false;
+    if (max_poly_verts < 3) max_poly_verts = 3;
+    if (max_poly_verts > AME_DECOMP_MAX_POLY_VERTS) max_poly_verts = AME_DECOMP_MAX_POLY_VERTS;
+
+    size_t nv = tri_count * 3;
+    bool ok = false;
+    DWeld* weld = (DWeld*)malloc(nv * sizeof(DWeld));
+    int* canon = (int*)malloc(nv * sizeof(int));
+    double* px = (double*)malloc(nv * sizeof(double));
+    double* py = (double*)malloc(nv * sizeof(double));
+    DPoly* polys = (DPoly*)malloc(tri_count * sizeof(DPoly));
+    int* parent = (int*)malloc(tri_count * sizeof(int));
+    DEdgeRec* edges = (DEdgeRec*)malloc(nv * sizeof(DEdgeRec));
+    DShared* shared = (DShared*)malloc(nv * sizeof(DShared));
+    if (!weld || !canon || !px || !py || !polys || !parent || !edges || !shared) goto done;
+
+    // Weld coincident vertices with a tolerance relative to the mesh size
+    double minx = tri_vertices[0], maxx = minx, miny = tri_vertices[1], maxy = miny;
+    for (size_t i = 0; i < nv; ++i) {
+        double x = tri_vertices[i*2+0], y = tri_vertices[i*2+1];
+        weld[i].x = x; weld[i].y = y; weld[i].src = (int)i;
+        canon[i] = -1;
+        if (x < minx) minx = x;
+        if (x > maxx) maxx = x;
+        if (y < miny) miny = y;
+        if (y > maxy) maxy = y;
+    }
+    double extent = fmax(maxx - minx, maxy - miny);
+    double eps = extent > 0.0 ? extent * 1e-6 : 1e-6;
+    qsort(weld, nv, sizeof(DWeld), cmp_weld);
+    int uniq = 0;
+    for (size_t i = 0; i < nv; ++i) {
+        if (canon[weld[i].src] >= 0) continue;
+        int id = uniq++;
+        px[id] = weld[i].x; py[id] = weld[i].y;
+        canon[weld[i].src] = id;
+        for (size_t j = i + 1; j < nv && weld[j].x - weld[i].x <= eps; ++j) {
+            if (canon[weld[j].src] < 0 && fabs(weld[j].y - weld[i].y) <= eps) canon[weld[j].src] = id;
+        }
+    }
+
+    // Triangles -> CCW polygons; drop degenerate ones
+    int np = 0;
+    double area_eps = eps * eps;
+    for (size_t t = 0; t < tri_count; ++t) {
+        int a = canon[t*3+0], b = canon[t*3+1], c = canon[t*3+2];
+        if (a == b || b == c || a == c) continue;
+        double cr = (px[b]-px[a])*(py[c]-py[a]) - (py[b]-py[a])*(px[c]-px[a]);
+        if (fabs(cr) <= area_eps) continue;
+        DPoly* p = &polys[np];
+        p->n = 3; p->v[0] = a;
+        if (cr > 0) { p->v[1] = b; p->v[2] = c; } else { p->v[1] = c; p->v[2] = b; }
+        parent[np] = np;
+        np++;
+    }
+    if (np == 0) goto done;
+
+    // Interior diagonals: edges used by exactly two triangles
+    int ne = 0;
+    for (int t = 0; t < np; ++t) {
+        for (int k = 0; k < 3; ++k) {
+            int a = polys[t].v[k], b = polys[t].v[(k + 1) % 3];
+            edges[ne].lo = a < b ? a : b; edges[ne].hi = a < b ? b : a; edges[ne].tri = t;
+            ne++;
+        }
+    }
+    qsort(edges, (size_t)ne, sizeof(DEdgeRec), cmp_edge);
+    int ns = 0;
+    for (int i = 0; i < ne; ) {
+        int j = i + 1;
+        while (j < ne && edges[j].lo == edges[i].lo && edges[j].hi == edges[i].hi) j++;
+        if (j - i == 2) {
+            DShared* s = &shared[ns++];
+            s->a = edges[i].lo; s->b = edges[i].hi; s->t0 = edges[i].tri; s->t1 = edges[i+1].tri;
+            double dx = px[s->b] - px[s->a], dy = py[s->b] - py[s->a];
+            s->len2 = dx*dx + dy*dy;
+        }
+        i = j;
+    }
+    qsort(shared, (size_t)ns, sizeof(DShared), cmp_shared);
+
+    // Hertel-Mehlhorn: drop every diagonal whose removal keeps the union convex
+    int alive = np;
+    for (int i = 0; i < ns; ++i) {
+        int r0 = uf_find(parent, shared[i].t0), r1 = uf_find(parent, shared[i].t1);
+        if (r0 == r1) continue;
+        DPoly merged;
+        if (!poly_merge(&polys[r0], &polys[r1], shared[i].a, shared[i].b, &merged)) continue;
+        if (!poly_ok(px, py, &merged, max_poly_verts)) continue;
+        polys[r0] = merged;
+        parent[r1] = r0;
+        alive--;
+    }
+
+    // Emit roots with straight corners removed
+    out->verts = (float*)malloc((size_t)alive * (size_t)max_poly_verts * 2 * sizeof(float));
+    out->offsets = (uint32_t*)malloc(((size_t)alive + 1) * sizeof(uint32_t));
+    if (!out->verts || !out->offsets) { ame_convex_decomp_free(out); goto done; }
+    size_t vc = 0, pc = 0;
+    out->offsets[0] = 0;
+    for (int t = 0; t < np; ++t) {
+        if (parent[t] != t) continue;
+        const DPoly* p = &polys[t];
+        for (int k = 0; k < p->n; ++k) {
+            if (fabs(corner_sin(px, py, p, k)) <= DECOMP_SIN_EPS) continue;
+            out->verts[vc*2+0] = (float)px[p->v[k]];
+            out->verts[vc*2+1] = (float)py[p->v[k]];
+            vc++;
+        }
+        out->offsets[++pc] = (uint32_t)vc;
+    }
+    out->poly_count = pc;
+    out->vert_count = vc;
+    out->source_triangles = (size_t)np;
+    ok = true;
+
+done:
+    free(weld); free(canon); free(px); free(py);
+    free(polys); free(parent); free(edges); free(shared);
+    return ok;
+}
+
+void ame_convex_decomp_free(AmeConvexDecomp* d) {
+    if (!d) return;
+    free(d->verts);
+    free(d->offsets);
+    memset(d, 0, sizeof(*d));
+}
@@ -1,4 +1,8 @@
 #include "ame/ecs.h"
+#include "ame/ecs_commands.h"
+#include "ame/profiler.h"
+#include "ecs_internal.h"
+#include <stdint.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -7,9 +11,23 @@
 #include <flecs/addons/pipeline.h>
 #include <SDL3/SDL.h>
 
-struct AmeEcsWorld {
-    ecs_world_t *world;
-};
+static int ame_hardware_threads(void) {
+    int n = SDL_GetNumLogicalCPUCores();
+    return n > 0 ? n : 1;
+}
+
+#ifdef FLECS_PERF_TRACE
+// Flecs brackets every system run (and a few internal passes) with these hooks
+static void ame_perf_trace_push(const char *file, size_t line, const char *name) {
+    (void)file; (void)line;
+    ame_profiler_begin(name);
+}
+
+static void ame_perf_trace_pop(const char *file, size_t line, const char *name) {
+    (void)file; (void)line; (void)name;
+    ame_profiler_end();
+}
+#endif
 
 // Use the default Flecs builtin pipeline instead of creating custom one
 static ecs_entity_t ame_create_default_pipeline(ecs_world_t *world) {
@@ -22,6 +40,10 @@ AmeEcsWorld* ame_ecs_world_create(void) {
     if (!w) return NULL;
     w->world = ecs_init();
     if (!w->world) { free(w); return NULL; }
+#ifdef FLECS_PERF_TRACE
+    ecs_os_api.perf_trace_push_ = ame_perf_trace_push;
+    ecs_os_api.perf_trace_pop_ = ame_perf_trace_pop;
+#endif
 
     // Centralized pipeline setup
     ecs_entity_t pipeline = ame_create_default_pipeline(w->world);
@@ -32,12 +54,37 @@ AmeEcsWorld* ame_ecs_world_create(void) {
         SDL_Log("[ECS] Using Flecs default builtin pipeline");
     }
 
+    const char* env_threads = getenv("AME_ECS_THREADS");
+    if (env_threads && *env_threads) {
+        ame_ecs_world_set_threads(w, atoi(env_threads));
+    }
+
     return w;
 }
 
 bool ame_ecs_world_progress(AmeEcsWorld* w, double dt) {
     if (!w || !w->world) return false;
-    return ecs_progress(w->world, (float)dt);
+    ame_profiler_begin("ame_ecs_world_progress");
+    // Sync point for commands recorded on other threads
+    ame_ecs_commands_flush(w);
+    bool ok = ecs_progress(w->world, (float)dt);
+    ame_profiler_end();
+    return ok;
+}
+
+void ame_ecs_world_set_threads(AmeEcsWorld* w, int threads) {
+    if (!w || !w->world) return;
+    if (threads == 0) threads = ame_hardware_threads();
+    if (threads < 1) threads = 1;
+    if (threads == w->threads || (threads == 1 && w->threads == 0)) return;
+    ecs_set_threads(w->world, threads);
+    w->threads = threads;
+    SDL_Log("[ECS] Worker threads: %d", threads);
+}
+
+int ame_ecs_world_get_threads(AmeEcsWorld* w) {
+    if (!w || !w->world) return 0;
+    return w->threads > 0 ? w->threads : 1;
 }
 
 void* ame_ecs_world_ptr(AmeEcsWorld* w) {
@@ -80,6 +127,65 @@ bool ame_ecs_get(AmeEcsWorld* w, AmeEcsId e, AmeEcsId comp, void* out, size_t si
     return true;
 }
 
+// extra_id (0: none) is added after the components without a value, e.g. an IsA pair
+static size_t bulk_create(AmeEcsWorld* w, size_t count, ecs_id_t extra_id,
+                          const AmeEcsId* component_ids, const void* const* component_data,
+                          size_t component_count, AmeEcsId* out_entities) {
+    if (!w || !w->world || count == 0 || count > INT32_MAX) return 0;
+    if (component_count && !component_ids) return 0;
+    ecs_bulk_desc_t bd = {0};
+    // ids[] is zero-terminated
+    size_t id_count = component_count + (extra_id ? 1 : 0);
+    if (id_count >= sizeof(bd.ids) / sizeof(bd.ids[0])) return 0;
+    void* data[sizeof(bd.ids) / sizeof(bd.ids[0])] = {0};
+    bool have_data = false;
+    for (size_t i = 0; i < component_count; ++i) {
+        bd.ids[i] = (ecs_id_t)component_ids[i];
+        if (component_data && component_data[i]) {
+            data[i] = (void*)component_data[i];
+            have_data = true;
+        }
+    }
+    if (extra_id) bd.ids[component_count] = extra_id;
+    bd.count = (int32_t)count;
+    bd.data = have_data ? data : NULL;
+    const ecs_entity_t* ents = ecs_bulk_init(w->world, &bd);
+    if (!ents) return 0;
+    // The returned array is only valid until the next world operation
+    if (out_entities) {
+        for (size_t i = 0; i < count; ++i) out_entities[i] = (AmeEcsId)ents[i];
+    }
+    return count;
+}
+
+size_t ame_ecs_bulk_create(AmeEcsWorld* w, size_t count,
+                           const AmeEcsId* component_ids, const void* const* component_data,
+                           size_t component_count, AmeEcsId* out_entities) {
+    return bulk_create(w, count, 0, component_ids, component_data, component_count, out_entities);
+}
+
+void ame_ecs_component_set_shared(AmeEcsWorld* w, AmeEcsId comp) {
+    if (!w || !w->world || !comp) return;
+    ecs_add_pair(w->world, (ecs_entity_t)comp, EcsOnInstantiate, EcsInherit);
+}
+
+AmeEcsId ame_ecs_prefab_new(AmeEcsWorld* w, const char* name) {
+    if (!w || !w->world) return 0;
+    ecs_entity_desc_t ed = {0};
+    ed.name = name;
+    ecs_entity_t e = ecs_entity_init(w->world, &ed);
+    ecs_add_id(w->world, e, EcsPrefab);
+    return (AmeEcsId)e;
+}
+
+size_t ame_ecs_instantiate(AmeEcsWorld* w, AmeEcsId prefab, size_t count,
+                           const AmeEcsId* component_ids, const void* const* component_data,
+                           size_t component_count, AmeEcsId* out_entities) {
+    if (!prefab) return 0;
+    return bulk_create(w, count, ecs_pair(EcsIsA, (ecs_entity_t)prefab), component_ids, component_data,
+                       component_count, out_entities);
+}
+
 bool ame_ecs_set_parent(AmeEcsWorld* w, AmeEcsId child, AmeEcsId parent) {
     if (!w || !w->world || !child) return false;
     ecs_world_t* world = w->world;
@@ -106,6 +212,7 @@ AmeEcsId ame_ecs_get_parent(AmeEcsWorld* w, AmeEcsId child) {
 
 void ame_ecs_world_destroy(AmeEcsWorld* w) {
     if (!w) return;
+    ame_ecs_commands_fini(w);
     if (w->world) {
         ecs_fini(w->world);
     }
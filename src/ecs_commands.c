@@ -0,0 +1,248 @@
+#include "ame/ecs_commands.h"
+#include "ame/profiler.h"
+#include "ecs_internal.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum {
+    CMD_CREATE = 1,
+    CMD_SET,
+    CMD_ADD,
+    CMD_REMOVE,
+    CMD_DESTROY
+};
+
+// One record; CMD_SET payload follows, padded to 8 bytes
+typedef struct CmdRecord {
+    uint32_t op;
+    uint32_t size;   // payload bytes
+    uint64_t entity;
+    uint64_t id;
+} CmdRecord;
+
+typedef struct AmeEcsCmdBatch {
+    struct AmeEcsCmdBatch *next;   // submitted list link
+    struct AmeEcsCommands *owner;  // applied batches are handed back for reuse
+    unsigned char *data;
+    size_t size, cap;
+    uint32_t commands;
+    uint32_t placeholders;
+    bool failed;                   // an append ran out of memory
+} AmeEcsCmdBatch;
+
+struct AmeEcsCommands {
+    AmeEcsWorld *world;
+    AmeEcsCmdBatch *open;                 // owner thread only
+    _Atomic(AmeEcsCmdBatch*) spare;       // emptied batch returned by the applier
+    struct AmeEcsCommands *next;          // world recorder list
+};
+
+static void batch_free(AmeEcsCmdBatch *b) {
+    if (!b) return;
+    free(b->data);
+    free(b);
+}
+
+static void batch_reset(AmeEcsCmdBatch *b) {
+    b->next = NULL;
+    b->size = 0;
+    b->commands = 0;
+    b->placeholders = 0;
+    b->failed = false;
+}
+
+// The recorder's open batch, reusing the spare one when the applier returned it
+static AmeEcsCmdBatch* open_batch(AmeEcsCommands *c) {
+    if (c->open) return c->open;
+    AmeEcsCmdBatch *b = atomic_exchange_explicit(&c->spare, NULL, memory_order_acquire);
+    if (!b) {
+        b = (AmeEcsCmdBatch*)calloc(1, sizeof *b);
+        if (!b) return NULL;
+        b->owner = c;
+    }
+    c->open = b;
+    return b;
+}
+
+static void record(AmeEcsCommands *c, uint32_t op, AmeEcsId e, AmeEcsId id, const void *data, size_t size) {
+    if (!c) return;
+    AmeEcsCmdBatch *b = open_batch(c);
+    if (!b || b->failed) return;
+    if (size > UINT32_MAX) { b->failed = true; return; }
+    size_t padded = (size + 7u) & ~(size_t)7u;
+    size_t need = b->size + sizeof(CmdRecord) + padded;
+    if (need > b->cap) {
+        size_t cap = b->cap ? b->cap : 1024;
+        while (cap < need) cap *= 2;
+        unsigned char *d = (unsigned char*)realloc(b->data, cap);
+        if (!d) { b->failed = true; return; }
+        b->data = d;
+        b->cap = cap;
+    }
+    CmdRecord r = { op, (uint32_t)size, (uint64_t)e, (uint64_t)id };
+    memcpy(b->data + b->size, &r, sizeof r);
+    if (size) {
+        memcpy(b->data + b->size + sizeof r, data, size);
+        memset(b->data + b->size + sizeof r + size, 0, padded - size);
+    }
+    b->size = need;
+    b->commands++;
+}
+
+AmeEcsCommands* ame_ecs_commands_create(AmeEcsWorld *w) {
+    if (!w) return NULL;
+    AmeEcsCommands *c = (AmeEcsCommands*)calloc(1, sizeof *c);
+    if (!c) return NULL;
+    c->world = w;
+    atomic_init(&c->spare, NULL);
+    AmeEcsCommands *head = atomic_load_explicit(&w->cmd_recorders, memory_order_relaxed);
+    do {
+        c->next = head;
+    } while (!atomic_compare_exchange_weak_explicit(&w->cmd_recorders, &head, c,
+                                                    memory_order_release, memory_order_relaxed));
+    return c;
+}
+
+AmeEcsId ame_ecs_cmd_create(AmeEcsCommands *c) {
+    if (!c) return 0;
+    AmeEcsCmdBatch *b = open_batch(c);
+    if (!b || b->failed) return 0;
+    AmeEcsId ph = AME_ECS_CMD_PLACEHOLDER | (AmeEcsId)b->placeholders;
+    record(c, CMD_CREATE, ph, 0, NULL, 0);
+    if (!b->failed) b->placeholders++;
+    return b->failed ? 0 : ph;
+}
+
+void ame_ecs_cmd_set(AmeEcsCommands *c, AmeEcsId e, AmeEcsId comp, const void *data, size_t size) {
+    if (!data || !size) return;
+    record(c, CMD_SET, e, comp, data, size);
+}
+
+void ame_ecs_cmd_add(AmeEcsCommands *c, AmeEcsId e, AmeEcsId id) {
+    record(c, CMD_ADD, e, id, NULL, 0);
+}
+
+// Pair halves are stored side by side in the payload so placeholders resolve independently
+void ame_ecs_cmd_add_pair(AmeEcsCommands *c, AmeEcsId e, AmeEcsId relationship, AmeEcsId target) {
+    AmeEcsId pair[2] = { relationship, target };
+    record(c, CMD_ADD, e, 0, pair, sizeof pair);
+}
+
+void ame_ecs_cmd_remove(AmeEcsCommands *c, AmeEcsId e, AmeEcsId id) {
+    record(c, CMD_REMOVE, e, id, NULL, 0);
+}
+
+void ame_ecs_cmd_destroy(AmeEcsCommands *c, AmeEcsId e) {
+    record(c, CMD_DESTROY, e, 0, NULL, 0);
+}
+
+bool ame_ecs_commands_submit(AmeEcsCommands *c) {
+    if (!c || !c->open) return true;
+    AmeEcsCmdBatch *b = c->open;
+    if (b->failed || b->commands == 0) {
+        bool ok = !b->failed;
+        batch_reset(b);
+        return ok;
+    }
+    c->open = NULL;
+    AmeEcsWorld *w = c->world;
+    AmeEcsCmdBatch *head = atomic_load_explicit(&w->cmd_submitted, memory_order_relaxed);
+    do {
+        b->next = head;
+    } while (!atomic_compare_exchange_weak_explicit(&w->cmd_submitted, &head, b,
+                                                    memory_order_release, memory_order_relaxed));
+    return true;
+}
+
+// Entity positions only; see AME_ECS_CMD_PLACEHOLDER
+static ecs_entity_t resolve(AmeEcsId id, const ecs_entity_t *created, uint32_t count) {
+    if (!(id & AME_ECS_CMD_PLACEHOLDER)) return (ecs_entity_t)id;
+    uint32_t idx = (uint32_t)(id & 0xffffffffu);
+    return idx < count ? created[idx] : 0;
+}
+
+static size_t apply_batch(ecs_world_t *world, const AmeEcsCmdBatch *b, ecs_entity_t *created) {
+    size_t applied = 0;
+    uint32_t n_created = 0;
+    size_t pos = 0;
+    while (pos + sizeof(CmdRecord) <= b->size) {
+        CmdRecord r;
+        memcpy(&r, b->data + pos, sizeof r);
+        const unsigned char *payload = b->data + pos + sizeof r;
+        pos += sizeof r + (((size_t)r.size + 7u) & ~(size_t)7u);
+        if (r.op == CMD_CREATE) {
+            created[n_created++] = ecs_new(world);
+            applied++;
+            continue;
+        }
+        ecs_entity_t e = resolve(r.entity, created, n_created);
+        if (!e || !ecs_is_alive(world, e)) continue;
+        ecs_id_t id = (ecs_id_t)r.id;
+        if (r.op == CMD_ADD && r.size == 2 * sizeof(AmeEcsId)) {
+            AmeEcsId pair[2];
+            memcpy(pair, payload, sizeof pair);
+            ecs_entity_t rel = resolve(pair[0], created, n_created);
+            ecs_entity_t tgt = resolve(pair[1], created, n_created);
+            if (!rel || !tgt || !ecs_is_alive(world, rel) || !ecs_is_alive(world, tgt)) continue;
+            id = ecs_pair(rel, tgt);
+        }
+        switch (r.op) {
+            case CMD_SET: ecs_set_id(world, e, id, (size_t)r.size, payload); break;
+            case CMD_ADD: ecs_add_id(world, e, id); break;
+            case CMD_REMOVE: ecs_remove_id(world, e, id); break;
+            case CMD_DESTROY: ecs_delete(world, e); break;
+            default: continue;
+        }
+        applied++;
+    }
+    return applied;
+}
+
+size_t ame_ecs_commands_flush(AmeEcsWorld *w) {
+    if (!w || !w->world) return 0;
+    AmeEcsCmdBatch *list = atomic_exchange_explicit(&w->cmd_submitted, NULL, memory_order_acquire);
+    if (!list) return 0;
+    ame_profiler_begin("ecs.commands");
+    // The stack holds newest first; reverse into submission order
+    AmeEcsCmdBatch *ordered = NULL;
+    while (list) {
+        AmeEcsCmdBatch *next = list->next;
+        list->next = ordered;
+        ordered = list;
+        list = next;
+    }
+    size_t applied = 0;
+    ecs_entity_t stack_created[64];
+    while (ordered) {
+        AmeEcsCmdBatch *b = ordered;
+        ordered = b->next;
+        ecs_entity_t *created = stack_created;
+        if (b->placeholders > 64) created = (ecs_entity_t*)malloc(b->placeholders * sizeof *created);
+        if (created) applied += apply_batch(w->world, b, created);
+        if (created != stack_created) free(created);
+        // Hand the buffer back to its recorder; drop whichever batch it replaces
+        batch_reset(b);
+        batch_free(atomic_exchange_explicit(&b->owner->spare, b, memory_order_release));
+    }
+    ame_profiler_end();
+    return applied;
+}
+
+void ame_ecs_commands_fini(AmeEcsWorld *w) {
+    if (!w) return;
+    AmeEcsCmdBatch *b = atomic_exchange(&w->cmd_submitted, NULL);
+    while (b) {
+        AmeEcsCmdBatch *next = b->next;
+        batch_free(b);
+        b = next;
+    }
+    AmeEcsCommands *c = atomic_exchange(&w->cmd_recorders, NULL);
+    while (c) {
+        AmeEcsCommands *next = c->next;
+        batch_free(c->open);
+        batch_free(atomic_load(&c->spare));
+        free(c);
+        c = next;
+    }
+}
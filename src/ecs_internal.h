@@ -0,0 +1,20 @@
+// Internal ECS world state shared by ecs.c and ecs_commands.c
+#pragma once
+
+#include "ame/ecs.h"
+#include <stdatomic.h>
+#include <flecs.h>
+
+struct AmeEcsCmdBatch;
+struct AmeEcsCommands;
+
+struct AmeEcsWorld {
+    ecs_world_t *world;
+    int threads;
+    // Deferred commands (ame/ecs_commands.h)
+    _Atomic(struct AmeEcsCmdBatch*) cmd_submitted; // newest first
+    _Atomic(struct AmeEcsCommands*) cmd_recorders;
+};
+
+// Free all recorders and unapplied batches; recording threads must have stopped
+void ame_ecs_commands_fini(AmeEcsWorld* w);
@@ -0,0 +1,634 @@
+#include "ame/ecs_snapshot.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define AME_SNAPSHOT_MMAP 1
+#endif
+
+// Bulk ids (FLECS_ID_DESC_MAX, 32) hold the schema columns plus the ChildOf and IsA pairs, the
+// Prefab and Disabled tags and the zero terminator
+#define AME_SNAPSHOT_MAX_COMPONENTS 27
+#define AME_SNAPSHOT_FLAG_SERIALIZED 1u
+#define AME_SNAPSHOT_TABLE_PREFAB 2u
+#define AME_SNAPSHOT_TABLE_DISABLED 1u
+
+static const char k_magic[8] = { 'A', 'M', 'E', 'S', 'N', 'A', 'P', '\0' };
+
+typedef struct SchemaEntry {
+    ecs_entity_t id;
+    char* name;      // full path, resolved again in the loading world
+    uint32_t size;
+    bool has_serializer;
+    AmeSnapshotSerializer serializer;
+} SchemaEntry;
+
+struct AmeSnapshotSchema {
+    SchemaEntry entries[AME_SNAPSHOT_MAX_COMPONENTS];
+    uint32_t count;
+};
+
+struct AmeSnapshotWriter {
+    uint8_t* data;
+    size_t size, cap;
+    bool failed;
+};
+
+struct AmeSnapshotFile {
+    void* data;
+    size_t size;
+    bool mapped;
+};
+
+// ---- writer ----
+
+bool ame_snapshot_write(AmeSnapshotWriter* out, const void* data, size_t size) {
+    if (!out || out->failed) return false;
+    if (size == 0) return true;
+    if (out->size + size > out->cap) {
+        size_t cap = out->cap ? out->cap : 4096;
+        while (cap < out->size + size) cap *= 2;
+        uint8_t* grown = (uint8_t*)realloc(out->data, cap);
+        if (!grown) { out->failed = true; return false; }
+        out->data = grown;
+        out->cap = cap;
+    }
+    if (data) memcpy(out->data + out->size, data, size);
+    else memset(out->data + out->size, 0, size);
+    out->size += size;
+    return true;
+}
+
+static void write_u32(AmeSnapshotWriter* out, uint32_t v) { ame_snapshot_write(out, &v, sizeof v); }
+static void write_u64(AmeSnapshotWriter* out, uint64_t v) { ame_snapshot_write(out, &v, sizeof v); }
+static void write_pad8(AmeSnapshotWriter* out) { ame_snapshot_write(out, NULL, (8 - (out->size & 7)) & 7); }
+
+// ---- reader ----
+
+typedef struct Reader {
+    const uint8_t* data;
+    size_t size, pos;
+    bool failed;
+} Reader;
+
+static const uint8_t* read_bytes(Reader* r, size_t n) {
+    if (r->failed || n > r->size - r->pos) { r->failed = true; return NULL; }
+    const uint8_t* p = r->data + r->pos;
+    r->pos += n;
+    return p;
+}
+
+static uint32_t read_u32(Reader* r) {
+    uint32_t v = 0;
+    const uint8_t* p = read_bytes(r, sizeof v);
+    if (p) memcpy(&v, p, sizeof v);
+    return v;
+}
+
+static uint64_t read_u64(Reader* r) {
+    uint64_t v = 0;
+    const uint8_t* p = read_bytes(r, sizeof v);
+    if (p) memcpy(&v, p, sizeof v);
+    return v;
+}
+
+static void read_pad8(Reader* r) { read_bytes(r, (8 - (r->pos & 7)) & 7); }
+
+// ---- entity -> snapshot index (open addressing; entity 0 marks an empty slot) ----
+
+typedef struct IndexMap {
+    uint64_t* keys;
+    uint32_t* values;
+    size_t mask;
+} IndexMap;
+
+static bool index_map_init(IndexMap* m, size_t count) {
+    size_t cap = 16;
+    while (cap < count * 2) cap *= 2;
+    m->keys = (uint64_t*)calloc(cap, sizeof(uint64_t));
+    m->values = (uint32_t*)malloc(cap * sizeof(uint32_t));
+    m->mask = cap - 1;
+    return m->keys && m->values;
+}
+
+static void index_map_fini(IndexMap* m) {
+    free(m->keys);
+    free(m->values);
+}
+
+static size_t index_map_slot(const IndexMap* m, uint64_t key) {
+    size_t i = (size_t)((key * 0x9E3779B97F4A7C15ull) >> 32) & m->mask;
+    while (m->keys[i] && m->keys[i] != key) i = (i + 1) & m->mask;
+    return i;
+}
+
+static void index_map_put(IndexMap* m, uint64_t key, uint32_t value) {
+    size_t i = index_map_slot(m, key);
+    m->keys[i] = key;
+    m->values[i] = value;
+}
+
+static bool index_map_get(const IndexMap* m, uint64_t key, uint32_t* out) {
+    size_t i = index_map_slot(m, key);
+    if (!m->keys[i]) return false;
+    *out = m->values[i];
+    return true;
+}
+
+// ---- schema ----
+
+#ifdef FLECS_META
+// True when the meta description of `type` contains pointers, strings or opaque storage
+static bool type_has_pointers(const ecs_world_t* w, ecs_entity_t type) {
+    const EcsPrimitive* prim = ecs_get(w, type, EcsPrimitive);
+    if (prim) return prim->kind == EcsUPtr || prim->kind == EcsIPtr || prim->kind == EcsString;
+    if (ecs_has(w, type, EcsVector) || ecs_has(w, type, EcsOpaque)) return true;
+    const EcsArray* arr = ecs_get(w, type, EcsArray);
+    if (arr) return type_has_pointers(w, arr->type);
+    const EcsStruct* st = ecs_get(w, type, EcsStruct);
+    if (st) {
+        const ecs_member_t* members = (const ecs_member_t*)ecs_vec_first(&st->members);
+        for (int32_t i = 0; i < ecs_vec_count(&st->members); ++i) {
+            if (type_has_pointers(w, members[i].type)) return true;
+        }
+    }
+    return false;
+}
+#endif
+
+AmeSnapshotSchema* ame_snapshot_schema_create(void) {
+    return (AmeSnapshotSchema*)calloc(1, sizeof(AmeSnapshotSchema));
+}
+
+void ame_snapshot_schema_destroy(AmeSnapshotSchema* schema) {
+    if (!schema) return;
+    for (uint32_t i = 0; i < schema->count; ++i) free(schema->entries[i].name);
+    free(schema);
+}
+
+bool ame_snapshot_schema_add(AmeSnapshotSchema* schema, ecs_world_t* w, ecs_entity_t component,
+                             const AmeSnapshotSerializer* serializer) {
+    if (!schema || !w || !component || schema->count >= AME_SNAPSHOT_MAX_COMPONENTS) return false;
+    const ecs_type_info_t* ti = ecs_get_type_info(w, component);
+    if (!ti || ti->size <= 0) return false;
+    if (serializer && (!serializer->save || !serializer->load)) return false;
+#ifdef FLECS_META
+    if (!serializer && type_has_pointers(w, component)) return false;
+#endif
+    char* path = ecs_get_path(w, component);
+    if (!path) return false;
+    SchemaEntry* e = &schema->entries[schema->count];
+    size_t n = strlen(path);
+    e->name = (char*)malloc(n + 1);
+    if (!e->name) { ecs_os_free(path); return false; }
+    memcpy(e->name, path, n + 1);
+    ecs_os_free(path);
+    e->id = component;
+    e->size = (uint32_t)ti->size;
+    e->has_serializer = serializer != NULL;
+    if (serializer) e->serializer = *serializer;
+    schema->count++;
+    return true;
+}
+
+// ---- save ----
+
+typedef struct SavedRange {
+    ecs_table_t* table;
+    const ecs_entity_t* entities;
+    int32_t offset, count;
+    uint32_t first;
+    ecs_entity_t parent, base; // ChildOf and IsA targets, shared by the table's rows
+    uint32_t flags;            // AME_SNAPSHOT_TABLE_*
+} SavedRange;
+
+typedef struct RangeEdge { uint32_t from, to; } RangeEdge;
+
+static int edge_cmp(const void* a, const void* b) {
+    const RangeEdge* x = (const RangeEdge*)a;
+    const RangeEdge* y = (const RangeEdge*)b;
+    return x->from < y->from ? -1 : x->from > y->from ? 1 : 0;
+}
+
+static bool push_edge(RangeEdge** edges, size_t* count, size_t* cap, uint32_t from, uint32_t to) {
+    if (*count == *cap) {
+        size_t grown_cap = *cap ? *cap * 2 : 64;
+        RangeEdge* grown = (RangeEdge*)realloc(*edges, grown_cap * sizeof(RangeEdge));
+        if (!grown) return false;
+        *edges = grown;
+        *cap = grown_cap;
+    }
+    (*edges)[(*count)++] = (RangeEdge){ from, to };
+    return true;
+}
+
+// Reorders tables so the loader can create each one with a single ecs_bulk_init: ChildOf and IsA
+// targets come before the tables that point at them, and the children of a prefab come after its
+// instances (an instance created while its prefab has children would get fresh copies of them on
+// top of the saved ones). Returns false on a cycle or when out of memory.
+static bool order_ranges(ecs_world_t* w, SavedRange* ranges, size_t range_count, uint64_t entity_count) {
+    if (range_count < 2) return true;
+    IndexMap owner; // entity -> range
+    RangeEdge* edges = NULL;
+    size_t edge_count = 0, edge_cap = 0;
+    uint32_t* indeg = (uint32_t*)calloc(range_count, sizeof(uint32_t));
+    uint32_t* start = (uint32_t*)calloc(range_count + 1, sizeof(uint32_t));
+    uint32_t* order = (uint32_t*)malloc(range_count * sizeof(uint32_t));
+    SavedRange* sorted = (SavedRange*)malloc(range_count * sizeof(SavedRange));
+    bool ok = index_map_init(&owner, (size_t)entity_count) && indeg && start && order && sorted;
+    for (size_t t = 0; ok && t < range_count; ++t) {
+        for (int32_t i = 0; i < ranges[t].count; ++i) index_map_put(&owner, ranges[t].entities[i], (uint32_t)t);
+    }
+    for (size_t t = 0; ok && t < range_count; ++t) {
+        const SavedRange* r = &ranges[t];
+        uint32_t from;
+        if (r->parent && index_map_get(&owner, r->parent, &from) && from != t) ok = push_edge(&edges, &edge_count, &edge_cap, from, (uint32_t)t);
+        if (ok && r->base && index_map_get(&owner, r->base, &from) && from != t) ok = push_edge(&edges, &edge_count, &edge_cap, from, (uint32_t)t);
+        if (!ok || !(r->flags & AME_SNAPSHOT_TABLE_PREFAB) || !r->parent || !ecs_has_id(w, r->parent, EcsPrefab)) continue;
+        for (size_t u = 0; ok && u < range_count; ++u) {
+            if (u != t && ranges[u].base == r->parent) ok = push_edge(&edges, &edge_count, &edge_cap, (uint32_t)u, (uint32_t)t);
+        }
+    }
+    size_t placed = 0;
+    if (ok) {
+        // Kahn's algorithm; ready tables keep their query order
+        if (edge_count) qsort(edges, edge_count, sizeof(RangeEdge), edge_cmp);
+        for (size_t e = 0; e < edge_count; ++e) { indeg[edges[e].to]++; start[edges[e].from + 1]++; }
+        for (size_t t = 0; t < range_count; ++t) start[t + 1] += start[t];
+        for (size_t t = 0; t < range_count; ++t) if (!indeg[t]) order[placed++] = (uint32_t)t;
+        for (size_t head = 0; head < placed; ++head) {
+            uint32_t t = order[head];
+            for (uint32_t e = start[t]; e < start[t + 1]; ++e) {
+                if (--indeg[edges[e].to] == 0) order[placed++] = edges[e].to;
+            }
+        }
+        ok = placed == range_count;
+    }
+    if (ok) {
+        uint32_t first = 0;
+        for (size_t t = 0; t < range_count; ++t) {
+            sorted[t] = ranges[order[t]];
+            sorted[t].first = first;
+            first += (uint32_t)sorted[t].count;
+        }
+        memcpy(ranges, sorted, range_count * sizeof(SavedRange));
+    }
+    index_map_fini(&owner);
+    free(edges);
+    free(indeg);
+    free(start);
+    free(order);
+    free(sorted);
+    return ok;
+}
+
+static bool write_file(const char* path, const AmeSnapshotWriter* out) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return false;
+    bool ok = fwrite(out->data, 1, out->size, f) == out->size;
+    if (fclose(f) != 0) ok = false;
+    return ok;
+}
+
+bool ame_snapshot_save(ecs_world_t* w, const AmeSnapshotSchema* schema, const char* path) {
+    if (!w || !schema || !schema->count || !path) return false;
+
+    // Every table with at least one schema component, prefabs and disabled entities included
+    ecs_query_desc_t qd = {0};
+    for (uint32_t i = 0; i < schema->count; ++i) {
+        qd.terms[i].id = schema->entries[i].id;
+        if (i + 1 < schema->count) qd.terms[i].oper = EcsOr;
+    }
+    qd.terms[schema->count].id = EcsPrefab;
+    qd.terms[schema->count].oper = EcsOptional;
+    qd.terms[schema->count + 1].id = EcsDisabled;
+    qd.terms[schema->count + 1].oper = EcsOptional;
+    ecs_query_t* q = ecs_query_init(w, &qd);
+    if (!q) return false;
+
+    // Pass 1: number entities in table order
+    SavedRange* ranges = NULL;
+    size_t range_count = 0, range_cap = 0;
+    uint64_t entity_count = 0;
+    ecs_iter_t it = ecs_query_iter(w, q);
+    while (ecs_query_next(&it)) {
+        if (range_count == range_cap) {
+            range_cap = range_cap ? range_cap * 2 : 64;
+            SavedRange* grown = (SavedRange*)realloc(ranges, range_cap * sizeof(SavedRange));
+            if (!grown) { ecs_iter_fini(&it); free(ranges); ecs_query_fini(q); return false; }
+            ranges = grown;
+        }
+        SavedRange* r = &ranges[range_count++];
+        r->table = it.table;
+        r->entities = it.entities;
+        r->offset = it.offset;
+        r->count = it.count;
+        r->first = (uint32_t)entity_count;
+        r->parent = it.count ? ecs_get_target(w, it.entities[0], EcsChildOf, 0) : 0;
+        r->base = it.count ? ecs_get_target(w, it.entities[0], EcsIsA, 0) : 0;
+        r->flags = (ecs_table_has_id(w, it.table, EcsPrefab) ? AME_SNAPSHOT_TABLE_PREFAB : 0u) |
+                   (ecs_table_has_id(w, it.table, EcsDisabled) ? AME_SNAPSHOT_TABLE_DISABLED : 0u);
+        entity_count += (uint64_t)it.count;
+    }
+    ecs_query_fini(q);
+    if (entity_count >= UINT32_MAX || !order_ranges(w, ranges, range_count, entity_count)) { free(ranges); return false; }
+
+    IndexMap index;
+    if (!index_map_init(&index, (size_t)entity_count)) { index_map_fini(&index); free(ranges); return false; }
+    for (size_t t = 0; t < range_count; ++t) {
+        for (int32_t i = 0; i < ranges[t].count; ++i) index_map_put(&index, ranges[t].entities[i], ranges[t].first + (uint32_t)i);
+    }
+
+    AmeSnapshotWriter out = {0};
+    ame_snapshot_write(&out, k_magic, sizeof k_magic);
+    write_u32(&out, AME_SNAPSHOT_VERSION);
+    write_u32(&out, schema->count);
+    write_u32(&out, (uint32_t)range_count);
+    size_t name_count_pos = out.size;
+    write_u32(&out, 0);
+    write_u64(&out, entity_count);
+
+    for (uint32_t i = 0; i < schema->count; ++i) {
+        const SchemaEntry* e = &schema->entries[i];
+        uint32_t n = (uint32_t)strlen(e->name);
+        write_u32(&out, n);
+        ame_snapshot_write(&out, e->name, n);
+        write_pad8(&out);
+        write_u32(&out, e->size);
+        write_u32(&out, e->has_serializer ? AME_SNAPSHOT_FLAG_SERIALIZED : 0u);
+    }
+
+    bool ok = true;
+    for (size_t t = 0; t < range_count && ok; ++t) {
+        const SavedRange* r = &ranges[t];
+        uint32_t cols[AME_SNAPSHOT_MAX_COMPONENTS];
+        int32_t col_index[AME_SNAPSHOT_MAX_COMPONENTS];
+        uint32_t col_count = 0;
+        for (uint32_t i = 0; i < schema->count; ++i) {
+            // Inherited columns are not in the table; the IsA pair brings them back on load
+            int32_t ci = ecs_table_get_column_index(w, r->table, schema->entries[i].id);
+            if (ci < 0) continue;
+            cols[col_count] = i;
+            col_index[col_count] = ci;
+            col_count++;
+        }
+        uint32_t parent = 0, base = 0, target;
+        if (r->parent && index_map_get(&index, r->parent, &target)) parent = target + 1;
+        if (r->base && index_map_get(&index, r->base, &target)) base = target + 1;
+
+        write_u32(&out, col_count);
+        write_u32(&out, parent);
+        write_u32(&out, base);
+        write_u32(&out, r->flags);
+        write_u32(&out, r->first);
+        write_u32(&out, (uint32_t)r->count);
+        for (uint32_t c = 0; c < col_count; ++c) write_u32(&out, cols[c]);
+        write_pad8(&out);
+        for (uint32_t c = 0; c < col_count && ok; ++c) {
+            const SchemaEntry* e = &schema->entries[cols[c]];
+            const void* column = ecs_table_get_column(r->table, col_index[c], r->offset);
+            size_t size_pos = out.size;
+            write_u64(&out, 0);
+            size_t start = out.size;
+            if (e->has_serializer) {
+                ok = e->serializer.save(column, r->count, &out, e->serializer.user);
+            } else {
+                ame_snapshot_write(&out, column, (size_t)e->size * (size_t)r->count);
+            }
+            if (out.failed) ok = false;
+            if (!ok) break;
+            uint64_t bytes = (uint64_t)(out.size - start);
+            memcpy(out.data + size_pos, &bytes, sizeof bytes);
+            write_pad8(&out);
+        }
+    }
+
+    uint32_t name_count = 0;
+    for (size_t t = 0; t < range_count && ok; ++t) {
+        for (int32_t i = 0; i < ranges[t].count; ++i) {
+            const char* name = ecs_get_name(w, ranges[t].entities[i]);
+            if (!name) continue;
+            uint32_t n = (uint32_t)strlen(name);
+            write_u32(&out, ranges[t].first + (uint32_t)i);
+            write_u32(&out, n);
+            ame_snapshot_write(&out, name, n);
+            write_pad8(&out);
+            name_count++;
+        }
+    }
+    if (out.failed) ok = false;
+    if (ok) {
+        memcpy(out.data + name_count_pos, &name_count, sizeof name_count);
+        ok = write_file(path, &out);
+    }
+
+    free(out.data);
+    index_map_fini(&index);
+    free(ranges);
+    return ok;
+}
+
+// ---- load ----
+
+typedef struct LoadedComponent {
+    const SchemaEntry* entry;  // NULL when the schema does not know this component
+    ecs_entity_t id;           // id in the loading world
+    uint32_t size;
+    bool serialized;
+} LoadedComponent;
+
+static const SchemaEntry* find_entry(const AmeSnapshotSchema* schema, const char* name, size_t len) {
+    for (uint32_t i = 0; i < schema->count; ++i) {
+        const SchemaEntry* e = &schema->entries[i];
+        if (strlen(e->name) == len && memcmp(e->name, name, len) == 0) return e;
+    }
+    return NULL;
+}
+
+bool ame_snapshot_load_memory(ecs_world_t* w, const AmeSnapshotSchema* schema,
+                              const void* data, size_t size, size_t* out_entity_count) {
+    if (out_entity_count) *out_entity_count = 0;
+    if (!w || !schema || !data) return false;
+    Reader r = { (const uint8_t*)data, size, 0, false };
+    const uint8_t* magic = read_bytes(&r, sizeof k_magic);
+    if (!magic || memcmp(magic, k_magic, sizeof k_magic) != 0) return false;
+    if (read_u32(&r) != AME_SNAPSHOT_VERSION) return false;
+    uint32_t component_count = read_u32(&r);
+    uint32_t table_count = read_u32(&r);
+    uint32_t name_count = read_u32(&r);
+    uint64_t entity_count = read_u64(&r);
+    if (r.failed || component_count > AME_SNAPSHOT_MAX_COMPONENTS || entity_count >= UINT32_MAX) return false;
+
+    LoadedComponent comps[AME_SNAPSHOT_MAX_COMPONENTS];
+    for (uint32_t i = 0; i < component_count; ++i) {
+        uint32_t len = read_u32(&r);
+        const char* name = (const char*)read_bytes(&r, len);
+        read_pad8(&r);
+        comps[i].size = read_u32(&r);
+        comps[i].serialized = (read_u32(&r) & AME_SNAPSHOT_FLAG_SERIALIZED) != 0;
+        if (r.failed) return false;
+        comps[i].entry = find_entry(schema, name, len);
+        comps[i].id = 0;
+        if (!comps[i].entry) continue;
+        ecs_entity_t id = ecs_lookup(w, comps[i].entry->name);
+        comps[i].id = id ? id : comps[i].entry->id;
+        // Raw columns must match the current layout; serialized ones go through the codec
+        const ecs_type_info_t* ti = ecs_get_type_info(w, comps[i].id);
+        if (!ti || comps[i].serialized != comps[i].entry->has_serializer ||
+            (!comps[i].serialized && (uint32_t)ti->size != comps[i].size)) {
+            comps[i].entry = NULL;
+        }
+    }
+
+    // Tables are saved in table order with ChildOf/IsA targets first, so each one is created by a
+    // single ecs_bulk_init whose targets already exist
+    ecs_entity_t* entities = (ecs_entity_t*)calloc((size_t)(entity_count ? entity_count : 1), sizeof(ecs_entity_t));
+    if (!entities) return false;
+
+    bool ok = true;
+    uint32_t next = 0;
+    for (uint32_t t = 0; t < table_count && ok; ++t) {
+        uint32_t col_count = read_u32(&r);
+        uint32_t parent = read_u32(&r);
+        uint32_t base = read_u32(&r);
+        uint32_t flags = read_u32(&r);
+        uint32_t first = read_u32(&r);
+        uint32_t rows = read_u32(&r);
+        if (r.failed || col_count > component_count || first != next || parent > first || base > first ||
+            (uint64_t)first + rows > entity_count) { ok = false; break; }
+        next = first + rows;
+        uint32_t cols[AME_SNAPSHOT_MAX_COMPONENTS];
+        for (uint32_t c = 0; c < col_count; ++c) {
+            cols[c] = read_u32(&r);
+            if (cols[c] >= component_count) ok = false;
+        }
+        read_pad8(&r);
+        if (!ok || r.failed) { ok = false; break; }
+
+        ecs_bulk_desc_t bd = {0};
+        void* values[AME_SNAPSHOT_MAX_COMPONENTS + 5] = {0};
+        void* scratch[AME_SNAPSHOT_MAX_COMPONENTS] = {0};
+        int n = 0;
+        for (uint32_t c = 0; c < col_count; ++c) {
+            uint64_t bytes = read_u64(&r);
+            const uint8_t* col = read_bytes(&r, (size_t)bytes);
+            read_pad8(&r);
+            if (r.failed) { ok = false; break; }
+            const LoadedComponent* lc = &comps[cols[c]];
+            if (!lc->entry || rows == 0) continue;
+            if (lc->serialized) {
+                const ecs_type_info_t* ti = ecs_get_type_info(w, lc->id);
+                void* buf = calloc(rows, (size_t)ti->size);
+                if (!buf || !lc->entry->serializer.load(buf, (int32_t)rows, col, (size_t)bytes, lc->entry->serializer.user)) {
+                    free(buf);
+                    ok = false;
+                    break;
+                }
+                scratch[c] = buf;
+                values[n] = buf;
+            } else {
+                if (bytes != (uint64_t)lc->size * rows) { ok = false; break; }
+                values[n] = (void*)col;
+            }
+            bd.ids[n++] = lc->id;
+        }
+        if (ok && rows) {
+            if (parent) bd.ids[n++] = ecs_pair(EcsChildOf, entities[parent - 1]);
+            if (base) bd.ids[n++] = ecs_pair(EcsIsA, entities[base - 1]);
+            if (flags & AME_SNAPSHOT_TABLE_PREFAB) bd.ids[n++] = EcsPrefab;
+            if (flags & AME_SNAPSHOT_TABLE_DISABLED) bd.ids[n++] = EcsDisabled;
+            bd.count = (int32_t)rows;
+            bd.data = values;
+            const ecs_entity_t* created = ecs_bulk_init(w, &bd);
+            if (created) memcpy(entities + first, created, (size_t)rows * sizeof(ecs_entity_t));
+            else ok = false;
+        } else {
+            // Never handed to the world: serializers release what they loaded
+            for (uint32_t c = 0; c < col_count; ++c) {
+                const LoadedComponent* lc = &comps[cols[c]];
+                if (scratch[c] && lc->entry->serializer.discard)
+                    lc->entry->serializer.discard(scratch[c], (int32_t)rows, lc->entry->serializer.user);
+            }
+        }
+        for (uint32_t c = 0; c < col_count; ++c) free(scratch[c]);
+    }
+
+    if (ok && next != entity_count) ok = false; // every entity belongs to a table
+    for (uint32_t i = 0; i < name_count && ok; ++i) {
+        uint32_t index = read_u32(&r);
+        uint32_t len = read_u32(&r);
+        const char* name = (const char*)read_bytes(&r, len);
+        read_pad8(&r);
+        if (r.failed || index >= entity_count) { ok = false; break; }
+        char small[128];
+        char* buf = len < sizeof small ? small : (char*)malloc((size_t)len + 1);
+        if (!buf) { ok = false; break; }
+        memcpy(buf, name, len);
+        buf[len] = '\0';
+        ecs_set_name(w, entities[index], buf);
+        if (buf != small) free(buf);
+    }
+
+    if (!ok) {
+        // Later tables hold the children; a parent's delete would take them along
+        for (uint64_t i = entity_count; i-- > 0;) {
+            if (entities[i] && ecs_is_alive(w, entities[i])) ecs_delete(w, entities[i]);
+        }
+    }
+    free(entities);
+    if (ok && out_entity_count) *out_entity_count = (size_t)entity_count;
+    return ok;
+}
+
+AmeSnapshotFile* ame_snapshot_load(ecs_world_t* w, const AmeSnapshotSchema* schema, const char* path,
+                                   size_t* out_entity_count) {
+    if (out_entity_count) *out_entity_count = 0;
+    if (!w || !schema || !path) return NULL;
+    AmeSnapshotFile* file = (AmeSnapshotFile*)calloc(1, sizeof(AmeSnapshotFile));
+    if (!file) return NULL;
+#ifdef AME_SNAPSHOT_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) { free(file); return NULL; }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) { close(fd); free(file); return NULL; }
+    void* map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) { free(file); return NULL; }
+    file->data = map;
+    file->size = (size_t)st.st_size;
+    file->mapped = true;
+#else
+    FILE* f = fopen(path, "rb");
+    if (!f) { free(file); return NULL; }
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    file->data = len > 0 ? malloc((size_t)len) : NULL;
+    if (!file->data || fread(file->data, 1, (size_t)len, f) != (size_t)len) {
+        fclose(f); free(file->data); free(file); return NULL;
+    }
+    fclose(f);
+    file->size = (size_t)len;
+#endif
+    if (!ame_snapshot_load_memory(w, schema, file->data, file->size, out_entity_count)) {
+        ame_snapshot_file_close(file);
+        return NULL;
+    }
+    return file;
+}
+
+void ame_snapshot_file_close(AmeSnapshotFile* file) {
+    if (!file) return;
+#ifdef AME_SNAPSHOT_MMAP
+    if (file->mapped) munmap(file->data, file->size);
+    else free(file->data);
+#else
+    free(file->data);
+#endif
+    free(file);
+}
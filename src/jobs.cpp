@@ -0,0 +1,124 @@
+#include "ame/jobs.h"
+#include <atomic>
+#include <cstdint>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct AmeJobPool {
+    std::vector<std::thread> workers;
+    std::mutex call_mutex;              // one parallel_for at a time
+    std::mutex mutex;
+    std::condition_variable work_cv;
+    std::condition_variable done_cv;
+    bool stop = false;
+
+    // Current batch; written under mutex while busy == 0
+    uint64_t generation = 0;
+    AmeJobFn fn = nullptr;
+    void* ctx = nullptr;
+    size_t count = 0;
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> done{0};
+    int busy = 0;                       // workers that took the current batch and may still claim
+};
+
+namespace {
+
+thread_local bool t_in_job = false;
+
+// Claim and run indices until the batch is exhausted; returns how many this thread ran
+size_t drain(AmeJobPool* p, AmeJobFn fn, void* ctx, size_t count) {
+    size_t ran = 0;
+    for (;;) {
+        size_t i = p->next.fetch_add(1, std::memory_order_relaxed);
+        if (i >= count) break;
+        fn(ctx, i);
+        ran++;
+    }
+    return ran;
+}
+
+void worker_main(AmeJobPool* p) {
+    t_in_job = true;
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(p->mutex);
+    for (;;) {
+        p->work_cv.wait(lock, [&] { return p->stop || p->generation != seen; });
+        if (p->stop) return;
+        seen = p->generation;
+        AmeJobFn fn = p->fn; void* ctx = p->ctx; size_t count = p->count;
+        p->busy++;
+        lock.unlock();
+        size_t ran = drain(p, fn, ctx, count);
+        lock.lock();
+        p->busy--;
+        if (ran && p->done.fetch_add(ran, std::memory_order_acq_rel) + ran == count) p->done_cv.notify_all();
+        else if (p->busy == 0) p->done_cv.notify_all();
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+AmeJobPool* ame_jobs_create(int worker_count) {
+    if (worker_count <= 0) {
+        unsigned hw = std::thread::hardware_concurrency();
+        worker_count = hw > 1 ? (int)hw - 1 : 0;
+    }
+    AmeJobPool* p = new AmeJobPool();
+    p->workers.reserve((size_t)worker_count);
+    for (int i = 0; i < worker_count; ++i) p->workers.emplace_back(worker_main, p);
+    return p;
+}
+
+void ame_jobs_destroy(AmeJobPool* pool) {
+    if (!pool) return;
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->stop = true;
+    }
+    pool->work_cv.notify_all();
+    for (std::thread& t : pool->workers) t.join();
+    delete pool;
+}
+
+int ame_jobs_worker_count(const AmeJobPool* pool) {
+    return pool ? (int)pool->workers.size() : 0;
+}
+
+void ame_jobs_parallel_for(AmeJobPool* pool, size_t count, AmeJobFn fn, void* ctx) {
+    if (!fn || count == 0) return;
+    if (!pool || pool->workers.empty() || count == 1 || t_in_job) {
+        for (size_t i = 0; i < count; ++i) fn(ctx, i);
+        return;
+    }
+    std::lock_guard<std::mutex> call(pool->call_mutex);
+    {
+        std::unique_lock<std::mutex> lock(pool->mutex);
+        // Late workers from the previous batch must let go before its fields are reused
+        pool->done_cv.wait(lock, [&] { return pool->busy == 0; });
+        pool->fn = fn; pool->ctx = ctx; pool->count = count;
+        pool->next.store(0, std::memory_order_relaxed);
+        pool->done.store(0, std::memory_order_relaxed);
+        pool->generation++;
+    }
+    pool->work_cv.notify_all();
+
+    t_in_job = true;
+    size_t ran = drain(pool, fn, ctx, count);
+    t_in_job = false;
+
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    if (ran) pool->done.fetch_add(ran, std::memory_order_acq_rel);
+    pool->done_cv.wait(lock, [&] { return pool->done.load(std::memory_order_acquire) == count; });
+}
+
+AmeJobPool* ame_jobs_shared(void) {
+    static AmeJobPool* shared = ame_jobs_create(0);
+    return shared;
+}
+
+} // extern "C"
@@ -5,7 +5,7 @@
 #include <string.h>
 
 // Mirror façade component PODs used in C++ facade registration
-typedef struct SpriteData { uint32_t tex; float u0,v0,u1,v1; float w,h; float r,g,b,a; int visible; int sorting_layer; int order_in_layer; float z; int dirty; } SpriteData;
+typedef struct SpriteData { uint32_t tex; float u0,v0,u1,v1; float w,h; float r,g,b,a; int visible; int sorting_layer; int order_in_layer; float z; } SpriteData;
 typedef struct MeshData { const float* pos; const float* uv; const float* col; size_t count; } MeshData;
 // Note: Col2D and MeshCol2D are now from ame/collider2d_system.h
 typedef struct AmeTransform2D AmeTransform2D; // forward already from physics.h
@@ -39,7 +39,7 @@ AmeObjImportResult ame_obj_import_obj(ecs_world_t* w, const char* filepath, cons
     ecs_entity_t comp_mesh = ensure_comp(w, "Mesh", sizeof(MeshData), _Alignof(MeshData));
     ecs_entity_t comp_col = ensure_comp(w, "Collider2D", sizeof(Col2D), _Alignof(Col2D));
     ecs_entity_t comp_tr  = ensure_comp(w, "AmeTransform2D", sizeof(AmeTransform2D), _Alignof(AmeTransform2D));
-    ecs_entity_t comp_meshcol = ensure_comp(w, "MeshCollider2D", sizeof(MeshCol2D), _Alignof(MeshCol2D));
+    ecs_entity_t comp_meshcol = ame_mesh_collider2d_component(w); // with the decomp cache hooks
 
     // Root entity grouping import if no parent provided
     if (cfg && cfg->parent) res.root = cfg->parent; else {
@@ -22,7 +22,7 @@
 
 // Mirror PODs used in engine registration (avoid C++ includes of facade headers)
 typedef struct MeshData { const float* pos; const float* uv; const float* col; size_t count; } MeshData;
-typedef struct MaterialData { uint32_t tex; float r,g,b,a; int dirty; } MaterialData;
+typedef struct MaterialData { uint32_t tex; float r,g,b,a; } MaterialData;
 typedef struct MaterialTexPath { const char* path; } MaterialTexPath;
 // Note: Col2D, EdgeCol2D, ChainCol2D, MeshCol2D are now imported from ame/collider2d_system.h
 
@@ -56,7 +56,7 @@ AmeObjImportResult ame_obj_import_obj(ecs_world_t* w, const char* filepath, cons
     // Extended colliders
     ecs_entity_t comp_edge = ensure_comp(w, "EdgeCollider2D", (int)sizeof(EdgeCol2D), (int)alignof(EdgeCol2D));
     ecs_entity_t comp_chain = ensure_comp(w, "ChainCollider2D", (int)sizeof(ChainCol2D), (int)alignof(ChainCol2D));
-    ecs_entity_t comp_mcol = ensure_comp(w, "MeshCollider2D", (int)sizeof(MeshCol2D), (int)alignof(MeshCol2D));
+    ecs_entity_t comp_mcol = ame_mesh_collider2d_component(w);
     // Physics body component (optional if physics world provided)
     ecs_entity_t comp_body = ensure_comp(w, "AmePhysicsBody", (int)sizeof(AmePhysicsBody), (int)alignof(AmePhysicsBody));
 
@@ -218,7 +218,7 @@ AmeObjImportResult ame_obj_import_obj(ecs_world_t* w, const char* filepath, cons
             const tinyobj::material_t& mt = materials[(size_t)shape_mat_id];
             MaterialData md = {0};
             md.tex = 0; // not loaded here
-            md.r = mt.diffuse[0]; md.g = mt.diffuse[1]; md.b = mt.diffuse[2]; md.a = 1.0f; md.dirty = 1;
+            md.r = mt.diffuse[0]; md.g = mt.diffuse[1]; md.b = mt.diffuse[2]; md.a = 1.0f;
             ecs_set_id(w, e, comp_mat, sizeof md, &md);
             if (!mt.diffuse_texname.empty()) {
                 // Build absolute path relative to OBJ directory
@@ -253,7 +253,7 @@ AmeObjImportResult ame_obj_import_obj(ecs_world_t* w, const char* filepath, cons
                     float bh = bw;
                     b2Body* body = ame_physics_create_body(cfg->physics_world, trc.x, trc.y, bw, bh, AME_BODY_STATIC, c.isTrigger != 0, nullptr);
                     if (body) {
-                        AmePhysicsBody pb = {0}; pb.body = body; pb.width = bw; pb.height = bh; pb.is_sensor = c.isTrigger != 0;
+                        AmePhysicsBody pb = {0}; pb.body = body; pb.handle = ame_physics_register_body(cfg->physics_world, body, (uint64_t)e); pb.width = bw; pb.height = bh; pb.is_sensor = c.isTrigger != 0;
                         ecs_set_id(w, e, comp_body, sizeof(pb), &pb);
                     }
                 }
@@ -270,7 +270,7 @@ AmeObjImportResult ame_obj_import_obj(ecs_world_t* w, const char* filepath, cons
                     float bh = std::max(0.1f, c.h);
                     b2Body* body = ame_physics_create_body(cfg->physics_world, trc.x, trc.y, bw, bh, AME_BODY_STATIC, c.isTrigger != 0, nullptr);
                     if (body) {
-                        AmePhysicsBody pb = {0}; pb.body = body; pb.width = bw; pb.height = bh; pb.is_sensor = c.isTrigger != 0;
+                        AmePhysicsBody pb = {0}; pb.body = body; pb.handle = ame_physics_register_body(cfg->physics_world, body, (uint64_t)e); pb.width = bw; pb.height = bh; pb.is_sensor = c.isTrigger != 0;
                         ecs_set_id(w, e, comp_body, sizeof(pb), &pb);
                     }
                 }
@@ -311,7 +311,7 @@ AmeObjImportResult ame_obj_import_obj(ecs_world_t* w, const char* filepath, cons
                         float cx = (minx+maxx)*0.5f, cy = (miny+maxy)*0.5f;
                         b2Body* body = ame_physics_create_body(cfg->physics_world, cx, cy, bw, bh, AME_BODY_STATIC, ch.isTrigger != 0, nullptr);
                         if (body) {
-                            AmePhysicsBody pb = {0}; pb.body = body; pb.width = bw; pb.height = bh; pb.is_sensor = ch.isTrigger != 0;
+                            AmePhysicsBody pb = {0}; pb.body = body; pb.handle = ame_physics_register_body(cfg->physics_world, body, (uint64_t)e); pb.width = bw; pb.height = bh; pb.is_sensor = ch.isTrigger != 0;
                             ecs_set_id(w, e, comp_body, sizeof(pb), &pb);
                         }
                     }
@@ -330,7 +330,18 @@ AmeObjImportResult ame_obj_import_obj(ecs_world_t* w, const char* filepath, cons
                     mc.vertices = pbuf;
                     mc.count = pos.size()/2;
                     mc.isTrigger = 0; mc.dirty = 1;
-                    ecs_set_id(w, e, comp_mcol, sizeof mc, &mc);
+                    // Decompose once at import; the collider system reuses the cached polygons
+                    AmeConvexDecomp* decomp = (AmeConvexDecomp*)calloc(1, sizeof(AmeConvexDecomp));
+                    if (decomp && ame_convex_decompose_triangles(pbuf, mc.count / 3, AME_DECOMP_MAX_POLY_VERTS, decomp)) {
+                        mc.decomp = decomp;
+                        std::fprintf(stdout, "[OBJ] MeshCollider decomposed: %zu triangles -> %zu convex polygons\n",
+                                     decomp->source_triangles, decomp->poly_count); fflush(stdout);
+                    } else {
+                        free(decomp);
+                    }
+                    // In place: a copy through ecs_set_id would drop the cache (MeshCol2D hooks)
+                    *(MeshCol2D*)ecs_ensure_id(w, e, comp_mcol) = mc;
+                    ecs_modified_id(w, e, comp_mcol);
                     res.colliders_created++; added_collider = true;
                     // Place collider entity at bbox center
                     AmeTransform2D trc = {0};
@@ -343,7 +354,7 @@ AmeObjImportResult ame_obj_import_obj(ecs_world_t* w, const char* filepath, cons
                         float bh = std::max(0.1f, maxy - miny);
                         b2Body* body = ame_physics_create_body(cfg->physics_world, trc.x, trc.y, bw, bh, AME_BODY_STATIC, mc.isTrigger != 0, nullptr);
                         if (body) {
-                            AmePhysicsBody pb = {0}; pb.body = body; pb.width = bw; pb.height = bh; pb.is_sensor = mc.isTrigger != 0;
+                            AmePhysicsBody pb = {0}; pb.body = body; pb.handle = ame_physics_register_body(cfg->physics_world, body, (uint64_t)e); pb.width = bw; pb.height = bh; pb.is_sensor = mc.isTrigger != 0;
                             ecs_set_id(w, e, comp_body, sizeof(pb), &pb);
                         }
                     }
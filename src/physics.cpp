@@ -1,11 +1,14 @@
 #include "ame/physics.h"
+#include "physics_internal.h"
 #include "ame/ecs.h"
 #include "ame/coords.h"
+#include "ame/profiler.h"
 #include <box2d/box2d.h>
 #include <cstdlib>
 #include <cstring>
 #include <cmath>
 #include <cstdio>
+#include <algorithm>
 #include <vector>
 
 // Raycast callback for single hit
@@ -71,21 +74,125 @@ AmePhysicsWorld* ame_physics_world_create(float gravity_x, float gravity_y, floa
     world->timestep = timestep;  // 1000 Hz timestep to match game tick rate
     world->velocity_iters = 6;
     world->position_iters = 2;
+    world->state = new AmePhysicsWorldState();
     
     return world;
 }
 
 void ame_physics_world_destroy(AmePhysicsWorld* world) {
     if (!world) return;
+    ame_physics_detail::destroy_tile_chunk_sets(world->state);
     if (world->world) {
         delete (b2World*)world->world;
     }
+    ame_physics_detail::destroy_contact_recorder(world->state);
+    delete world->state;
     free(world);
 }
 
+// Step without running the post-step callback; safe on a worker as long as no other thread touches this world
+static void step_world(AmePhysicsWorld* world) {
+    AmeProfileScope prof("physics.step");
+    auto t0 = ame_physics_detail::stat_clock::now();
+    ((b2World*)world->world)->Step(world->timestep, world->velocity_iters, world->position_iters);
+    ame_physics_detail::refresh_poses(world->state);
+    ame_physics_detail::publish_contact_events(world->state);
+    if (AmePhysicsWorldState* st = world->state) {
+        st->wall_step_ms = std::chrono::duration<float, std::milli>(ame_physics_detail::stat_clock::now() - t0).count();
+        st->step_count++;
+        st->raycast_count.store(0, std::memory_order_relaxed);
+        st->raycast_ns.store(0, std::memory_order_relaxed);
+    }
+}
+
+static void run_post_step(AmePhysicsWorld* world) {
+    AmePhysicsWorldState* st = world->state;
+    if (!st || !st->post_step) return;
+    AmeProfileScope prof("physics.post_step");
+    st->post_step(world, st->post_step_user);
+}
+
 void ame_physics_world_step(AmePhysicsWorld* world) {
     if (!world || !world->world) return;
-    ((b2World*)world->world)->Step(world->timestep, world->velocity_iters, world->position_iters);
+    step_world(world);
+    run_post_step(world);
+}
+
+void ame_physics_world_set_post_step(AmePhysicsWorld* world, AmePhysicsStepCallback fn, void* user) {
+    if (!world || !world->state) return;
+    world->state->post_step = fn;
+    world->state->post_step_user = user;
+}
+
+struct ParallelStep {
+    AmePhysicsWorld* const* worlds;
+    const uint32_t* order;
+};
+
+static void step_job(void* ctx, size_t i) {
+    ParallelStep* ps = (ParallelStep*)ctx;
+    step_world(ps->worlds[ps->order[i]]);
+}
+
+void ame_physics_worlds_step_parallel_pool(AmeJobPool* pool, AmePhysicsWorld* const* worlds, size_t count) {
+    if (!worlds || count == 0) return;
+    // Most expensive world (by last step) first so the longest job starts immediately
+    std::vector<uint32_t> order;
+    order.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (worlds[i] && worlds[i]->world) order.push_back((uint32_t)i);
+    }
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        const AmePhysicsWorldState* sa = worlds[a]->state;
+        const AmePhysicsWorldState* sb = worlds[b]->state;
+        return (sa ? sa->wall_step_ms : 0.0f) > (sb ? sb->wall_step_ms : 0.0f);
+    });
+    ParallelStep ps = { worlds, order.data() };
+    ame_jobs_parallel_for(pool, order.size(), step_job, &ps);
+    // Join barrier passed: callbacks run here, on the caller, in input order
+    for (size_t i = 0; i < count; ++i) {
+        if (worlds[i] && worlds[i]->world) run_post_step(worlds[i]);
+    }
+}
+
+void ame_physics_worlds_step_parallel(AmePhysicsWorld* const* worlds, size_t count) {
+    ame_physics_worlds_step_parallel_pool(ame_jobs_shared(), worlds, count);
+}
+
+void ame_physics_get_stats(const AmePhysicsWorld* world, AmePhysicsStats* out_stats) {
+    if (!out_stats) return;
+    *out_stats = AmePhysicsStats{};
+    if (!world || !world->world) return;
+    b2World* w = world->world;
+    const b2Profile& prof = w->GetProfile();
+    out_stats->step_ms = prof.step;
+    out_stats->collide_ms = prof.collide;
+    out_stats->solve_ms = prof.solve;
+    out_stats->solve_init_ms = prof.solveInit;
+    out_stats->solve_velocity_ms = prof.solveVelocity;
+    out_stats->solve_position_ms = prof.solvePosition;
+    out_stats->solve_toi_ms = prof.solveTOI;
+    out_stats->broadphase_ms = prof.broadphase;
+    out_stats->body_count = w->GetBodyCount();
+    out_stats->contact_count = w->GetContactCount();
+    out_stats->proxy_count = w->GetProxyCount();
+    out_stats->joint_count = w->GetJointCount();
+    out_stats->tree_height = w->GetTreeHeight();
+    for (b2Body* b = w->GetBodyList(); b; b = b->GetNext()) {
+        if (b->GetType() == b2_staticBody) out_stats->static_body_count++;
+        else if (b->IsAwake()) out_stats->awake_body_count++;
+    }
+    for (b2Contact* c = w->GetContactList(); c; c = c->GetNext()) {
+        if (c->IsTouching()) out_stats->touching_contact_count++;
+    }
+    if (const AmePhysicsWorldState* st = world->state) {
+        out_stats->wall_step_ms = st->wall_step_ms;
+        out_stats->registered_body_count = (uint32_t)st->bodies.size();
+        out_stats->raycast_count = st->raycast_count.load(std::memory_order_relaxed);
+        out_stats->raycast_ms = (float)((double)st->raycast_ns.load(std::memory_order_relaxed) / 1.0e6);
+        out_stats->step_count = st->step_count;
+        out_stats->parked_body_count = st->parked_count;
+    }
 }
 
 b2Body* ame_physics_create_body(AmePhysicsWorld* world, float x, float y, 
@@ -123,6 +230,7 @@ b2Body* ame_physics_create_body(AmePhysicsWorld* world, float x, float y,
     fixtureDef.isSensor = is_sensor;
     
     body->CreateFixture(&fixtureDef);
+    ame_physics_register_body(world, body, 0);
     
     return body;
 }
@@ -170,7 +278,43 @@ void ame_physics_create_tilemap_collision(AmePhysicsWorld* world,
 
 void ame_physics_destroy_body(AmePhysicsWorld* world, b2Body* body) {
     if (!world || !world->world || !body) return;
+    // Destroy first so EndContact events for this body still resolve its entity
     ((b2World*)world->world)->DestroyBody(body);
+    ame_physics_detail::unregister_body(world->state, body);
+}
+
+b2Body* ame_physics_clone_body(AmePhysicsWorld* world, b2Body* src, float x, float y, float angle) {
+    if (!world || !world->world || !src) return NULL;
+    b2World* bw = (b2World*)world->world;
+    if (bw->IsLocked()) return NULL;
+
+    b2BodyDef bodyDef;
+    bodyDef.type = src->GetType();
+    bodyDef.position.Set(x, y);
+    bodyDef.angle = angle;
+    bodyDef.linearDamping = src->GetLinearDamping();
+    bodyDef.angularDamping = src->GetAngularDamping();
+    bodyDef.allowSleep = src->IsSleepingAllowed();
+    bodyDef.fixedRotation = src->IsFixedRotation();
+    bodyDef.bullet = src->IsBullet();
+    bodyDef.gravityScale = src->GetGravityScale();
+    bodyDef.userData = src->GetUserData();
+    b2Body* body = bw->CreateBody(&bodyDef);
+
+    for (b2Fixture* f = src->GetFixtureList(); f; f = f->GetNext()) {
+        b2FixtureDef fixtureDef;
+        fixtureDef.shape = f->GetShape();
+        fixtureDef.density = f->GetDensity();
+        fixtureDef.friction = f->GetFriction();
+        fixtureDef.restitution = f->GetRestitution();
+        fixtureDef.restitutionThreshold = f->GetRestitutionThreshold();
+        fixtureDef.isSensor = f->IsSensor();
+        fixtureDef.filter = f->GetFilterData();
+        fixtureDef.userData = f->GetUserData();
+        body->CreateFixture(&fixtureDef);
+    }
+    ame_physics_register_body(world, body, 0);
+    return body;
 }
 
 void ame_physics_get_position(b2Body* body, float* x, float* y) {
@@ -197,6 +341,19 @@ void ame_physics_set_velocity(b2Body* body, float vx, float vy) {
     body->SetLinearVelocity(b2Vec2(vx, vy));
 }
 
+float ame_physics_get_angular_velocity(b2Body* body) {
+    return body ? body->GetAngularVelocity() : 0.0f;
+}
+
+void ame_physics_set_angular_velocity(b2Body* body, float w) {
+    if (!body) return;
+    body->SetAngularVelocity(w);
+}
+
+float ame_physics_get_angle(b2Body* body) {
+    return body ? body->GetAngle() : 0.0f;
+}
+
 void ame_physics_set_angle(b2Body* body, float angle) {
     if (!body) return;
     b2Vec2 pos = body->GetPosition();
@@ -209,6 +366,7 @@ AmeRaycastHit ame_physics_raycast(AmePhysicsWorld* world,
     AmeRaycastHit result = {0};
     if (!world || !world->world) return result;
     
+    ame_physics_detail::RaycastTimer timer(world->state);
     b2Vec2 p1(start_x, start_y);
     b2Vec2 p2(end_x, end_y);
     
@@ -224,6 +382,7 @@ AmeRaycastHit ame_physics_raycast(AmePhysicsWorld* world,
         result.fraction = callback.fraction;
         result.body = callback.body;
         result.user_data = (void*)((callback.body) ? callback.body->GetUserData().pointer : 0);
+        result.entity = ame_physics_detail::entity_of(world->state, callback.body);
     }
     
     return result;
@@ -236,6 +395,7 @@ AmeRaycastMultiHit ame_physics_raycast_all(AmePhysicsWorld* world,
     AmeRaycastMultiHit result = {0};
     if (!world || !world->world || max_hits == 0) return result;
     
+    ame_physics_detail::RaycastTimer timer(world->state);
     result.hits = (AmeRaycastHit*)calloc(max_hits, sizeof(AmeRaycastHit));
     result.capacity = max_hits;
     
@@ -246,6 +406,9 @@ AmeRaycastMultiHit ame_physics_raycast_all(AmePhysicsWorld* world,
     ((b2World*)world->world)->RayCast(&callback, p1, p2);
     
     result.count = callback.count;
+    for (size_t i = 0; i < result.count; ++i) {
+        result.hits[i].entity = ame_physics_detail::entity_of(world->state, result.hits[i].body);
+    }
     
     return result;
 }
@@ -351,4 +514,78 @@ void ame_physics_add_mesh_triangles_world(b2Body* body,
     }
 }
 
+void ame_physics_add_convex_polygons_world(b2Body* body,
+                                           const float* verts, const uint32_t* offsets, size_t poly_count,
+                                           bool is_sensor, float density, float friction){
+    if (!body || !verts || !offsets || poly_count == 0) return;
+    b2Vec2 bodyPos = body->GetPosition();
+    for (size_t p=0; p<poly_count; ++p){
+        uint32_t first = offsets[p];
+        int n = (int)(offsets[p+1] - first);
+        if (n < 3 || n > b2_maxPolygonVertices) continue;
+        b2Vec2 arr[b2_maxPolygonVertices];
+        for (int k=0; k<n; ++k) arr[k].Set(verts[(first+k)*2+0] - bodyPos.x, verts[(first+k)*2+1] - bodyPos.y);
+        b2PolygonShape poly;
+        poly.Set(arr, n);
+        b2FixtureDef fd; fd.shape = &poly; fd.isSensor = is_sensor; fd.density = density; fd.friction = friction;
+        body->CreateFixture(&fd);
+    }
+}
+
+void ame_physics_add_box_fixture(b2Body* body, float width, float height,
+                                 bool is_sensor, float density, float friction){
+    if (!body || width <= 0.0f || height <= 0.0f) return;
+    b2PolygonShape box;
+    box.SetAsBox(width * 0.5f, height * 0.5f);
+    b2FixtureDef fd; fd.shape = &box; fd.isSensor = is_sensor; fd.density = density; fd.friction = friction;
+    body->CreateFixture(&fd);
+}
+
+void ame_physics_add_circle_fixture(b2Body* body, float radius,
+                                    bool is_sensor, float density, float friction){
+    if (!body || radius <= 0.0f) return;
+    b2CircleShape circle;
+    circle.m_p.Set(0.0f, 0.0f);
+    circle.m_radius = radius;
+    b2FixtureDef fd; fd.shape = &circle; fd.isSensor = is_sensor; fd.density = density; fd.friction = friction;
+    body->CreateFixture(&fd);
+}
+
+// Returns the body's only fixture when it has the requested shape type, else NULL
+static b2Fixture* single_fixture_of_type(b2Body* body, b2Shape::Type type){
+    if (!body) return nullptr;
+    b2Fixture* f = body->GetFixtureList();
+    if (!f || f->GetNext() || f->GetType() != type) return nullptr;
+    return f;
+}
+
+// Shape edits bypass Box2D's proxy bookkeeping: refresh mass and re-sync the broadphase
+static void refresh_after_shape_edit(b2Body* body){
+    body->ResetMassData();
+    body->SetTransform(body->GetPosition(), body->GetAngle());
+    body->SetAwake(true);
+}
+
+bool ame_physics_update_box_fixture(b2Body* body, float width, float height, bool is_sensor){
+    b2Fixture* f = single_fixture_of_type(body, b2Shape::e_polygon);
+    if (!f || width <= 0.0f || height <= 0.0f) return false;
+    b2PolygonShape* poly = (b2PolygonShape*)f->GetShape();
+    // Only a centered, axis-aligned box is safe to resize in place
+    if (poly->m_count != 4 || poly->m_centroid.LengthSquared() > b2_epsilon) return false;
+    poly->SetAsBox(width * 0.5f, height * 0.5f);
+    f->SetSensor(is_sensor);
+    refresh_after_shape_edit(body);
+    return true;
+}
+
+bool ame_physics_update_circle_fixture(b2Body* body, float radius, bool is_sensor){
+    b2Fixture* f = single_fixture_of_type(body, b2Shape::e_circle);
+    if (!f || radius <= 0.0f) return false;
+    b2CircleShape* circle = (b2CircleShape*)f->GetShape();
+    circle->m_radius = radius;
+    f->SetSensor(is_sensor);
+    refresh_after_shape_edit(body);
+    return true;
+}
+
 } // extern "C"
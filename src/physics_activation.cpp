@@ -0,0 +1,239 @@
+#include "ame/physics_activation.h"
+#include "physics_internal.h"
+#include <algorithm>
+
+using namespace ame_physics_detail;
+
+struct AmeTileChunkColliders {
+    AmePhysicsWorld* world = nullptr;
+    std::vector<int> tiles;
+    int width = 0, height = 0;
+    float tile_size = 1.0f;
+    int chunk_tiles = 16;
+    int chunks_x = 0, chunks_y = 0;
+    std::vector<b2Body*> bodies;     // per chunk; null when unloaded or empty
+    std::vector<uint8_t> loaded;
+    size_t loaded_count = 0;
+};
+
+namespace {
+
+inline bool overlaps(const AmePhysicsFocus& f, float margin, float min_x, float min_y, float max_x, float max_y) {
+    return max_x >= f.min_x - margin && min_x <= f.max_x + margin &&
+           max_y >= f.min_y - margin && min_y <= f.max_y + margin;
+}
+
+inline bool any_focus(const AmePhysicsFocus* foci, size_t count, float margin,
+                      float min_x, float min_y, float max_x, float max_y) {
+    for (size_t i = 0; i < count; ++i) {
+        if (overlaps(foci[i], margin, min_x, min_y, max_x, max_y)) return true;
+    }
+    return false;
+}
+
+void set_parked(AmePhysicsWorldState* st, uint32_t d, bool parked) {
+    bool is_parked = (st->activation[d] & AME_ACT_PARKED) != 0;
+    if (parked == is_parked) return;
+    if (!(st->activation[d] & AME_ACT_HELD)) st->bodies[d]->SetEnabled(!parked);
+    if (parked) { st->activation[d] |= AME_ACT_PARKED; st->parked_count++; }
+    else        { st->activation[d] &= (uint8_t)~AME_ACT_PARKED; st->parked_count--; }
+}
+
+// One static body per chunk; solid tiles merged greedily into rectangles (run right, then grow up)
+b2Body* build_chunk(AmeTileChunkColliders* cs, int cx, int cy) {
+    const int x0 = cx * cs->chunk_tiles, y0 = cy * cs->chunk_tiles;
+    const int x1 = std::min(x0 + cs->chunk_tiles, cs->width), y1 = std::min(y0 + cs->chunk_tiles, cs->height);
+    const int cw = x1 - x0, ch = y1 - y0;
+    const float ts = cs->tile_size;
+    std::vector<uint8_t> used((size_t)cw * (size_t)ch, 0);
+    auto solid = [&](int x, int y) {
+        return cs->tiles[(size_t)(y0 + y) * (size_t)cs->width + (size_t)(x0 + x)] != 0 && !used[(size_t)y * cw + x];
+    };
+    b2Body* body = nullptr;
+    for (int y = 0; y < ch; ++y) {
+        for (int x = 0; x < cw; ++x) {
+            if (!solid(x, y)) continue;
+            int run = 1;
+            while (x + run < cw && solid(x + run, y)) run++;
+            int rows = 1;
+            for (;;) {
+                if (y + rows >= ch) break;
+                bool full = true;
+                for (int k = 0; k < run && full; ++k) full = solid(x + k, y + rows);
+                if (!full) break;
+                rows++;
+            }
+            for (int yy = 0; yy < rows; ++yy)
+                for (int k = 0; k < run; ++k) used[(size_t)(y + yy) * cw + x + k] = 1;
+            if (!body) {
+                b2BodyDef bd;
+                bd.type = b2_staticBody;
+                bd.position.Set((float)x0 * ts, (float)y0 * ts);
+                body = cs->world->world->CreateBody(&bd);
+            }
+            b2PolygonShape box;
+            box.SetAsBox(run * ts * 0.5f, rows * ts * 0.5f,
+                         b2Vec2((x + run * 0.5f) * ts, (y + rows * 0.5f) * ts), 0.0f);
+            b2FixtureDef fd; fd.shape = &box; fd.density = 0.0f; fd.friction = 0.3f;
+            body->CreateFixture(&fd);
+            x += run - 1;
+        }
+    }
+    return body;
+}
+
+void update_chunks(AmeTileChunkColliders* cs, const AmePhysicsFocus* foci, size_t count,
+                   float enter_margin, float exit_margin) {
+    const float span = cs->chunk_tiles * cs->tile_size;
+    for (int cy = 0; cy < cs->chunks_y; ++cy) {
+        for (int cx = 0; cx < cs->chunks_x; ++cx) {
+            size_t i = (size_t)cy * (size_t)cs->chunks_x + (size_t)cx;
+            float min_x = cx * span, min_y = cy * span, max_x = min_x + span, max_y = min_y + span;
+            if (!cs->loaded[i]) {
+                if (count == 0 || any_focus(foci, count, enter_margin, min_x, min_y, max_x, max_y)) {
+                    cs->bodies[i] = build_chunk(cs, cx, cy);
+                    cs->loaded[i] = 1;
+                    cs->loaded_count++;
+                }
+            } else if (count > 0 && !any_focus(foci, count, exit_margin, min_x, min_y, max_x, max_y)) {
+                if (cs->bodies[i]) cs->world->world->DestroyBody(cs->bodies[i]);
+                cs->bodies[i] = nullptr;
+                cs->loaded[i] = 0;
+                cs->loaded_count--;
+            }
+        }
+    }
+}
+
+} // namespace
+
+namespace ame_physics_detail {
+
+void destroy_tile_chunk_sets(AmePhysicsWorldState* st) {
+    if (!st) return;
+    // Bodies go away with the b2World; only the bookkeeping is freed here
+    for (AmeTileChunkColliders* cs : st->chunk_sets) delete cs;
+    st->chunk_sets.clear();
+}
+
+} // namespace ame_physics_detail
+
+extern "C" {
+
+AmePhysicsFocus ame_physics_focus_around(float x, float y, float half_w, float half_h) {
+    AmePhysicsFocus f;
+    f.min_x = x - half_w; f.max_x = x + half_w;
+    f.min_y = y - half_h; f.max_y = y + half_h;
+    return f;
+}
+
+AmePhysicsFocus ame_physics_focus_from_camera(const AmeCamera* cam, float margin) {
+    if (!cam) return ame_physics_focus_around(0.0f, 0.0f, margin, margin);
+    float zoom = cam->zoom > 0.0f ? cam->zoom : 1.0f;
+    float half_w = (float)cam->viewport_w / (2.0f * zoom);
+    float half_h = (float)cam->viewport_h / (2.0f * zoom);
+    // Same view rectangle as the ECS render pipeline: centered on the follow target
+    return ame_physics_focus_around(cam->target_x, cam->target_y, half_w + margin, half_h + margin);
+}
+
+void ame_physics_activation_configure(AmePhysicsWorld* world, const AmePhysicsActivationConfig* cfg) {
+    if (!world || !world->state || !cfg) return;
+    world->state->act_enter_margin = std::max(0.0f, cfg->enter_margin);
+    world->state->act_exit_margin = std::max(world->state->act_enter_margin, cfg->exit_margin);
+}
+
+void ame_physics_activation_update(AmePhysicsWorld* world, const AmePhysicsFocus* foci, size_t count) {
+    if (!world || !world->world || !world->state) return;
+    if (world->world->IsLocked()) return; // never toggle bodies from inside Step callbacks
+    AmePhysicsWorldState* st = world->state;
+    if (!foci) count = 0;
+    const float enter = st->act_enter_margin, exit = st->act_exit_margin;
+
+    const uint32_t n = (uint32_t)st->bodies.size();
+    for (uint32_t d = 0; d < n; ++d) {
+        uint8_t a = st->activation[d];
+        if (a & (AME_ACT_ALWAYS | AME_ACT_HELD)) continue;
+        if (count == 0) { set_parked(st, d, false); continue; }
+        if (a & AME_ACT_PARKED) {
+            // Parked bodies can still be teleported by gameplay; read the body, not the cache
+            const b2Vec2& p = st->bodies[d]->GetPosition();
+            if (any_focus(foci, count, enter, p.x, p.y, p.x, p.y)) set_parked(st, d, false);
+        } else {
+            float x = st->x[d], y = st->y[d];
+            if (!any_focus(foci, count, exit, x, y, x, y)) set_parked(st, d, true);
+        }
+    }
+
+    for (AmeTileChunkColliders* cs : st->chunk_sets) update_chunks(cs, foci, count, enter, exit);
+}
+
+void ame_physics_body_set_always_active(AmePhysicsWorld* world, AmeBodyHandle handle, bool always_active) {
+    if (!world) return;
+    AmePhysicsWorldState* st = world->state;
+    uint32_t si = resolve_slot(st, handle);
+    if (si == UINT32_MAX) return;
+    uint32_t d = st->slots[si].dense;
+    if (always_active) {
+        set_parked(st, d, false);
+        st->activation[d] |= AME_ACT_ALWAYS;
+    } else {
+        st->activation[d] &= (uint8_t)~AME_ACT_ALWAYS;
+    }
+}
+
+bool ame_physics_body_is_active(const AmePhysicsWorld* world, AmeBodyHandle handle) {
+    if (!world) return false;
+    const AmePhysicsWorldState* st = world->state;
+    uint32_t si = resolve_slot(st, handle);
+    if (si == UINT32_MAX) return false;
+    return (st->activation[st->slots[si].dense] & (AME_ACT_PARKED | AME_ACT_HELD)) == 0;
+}
+
+void ame_physics_body_set_held(AmePhysicsWorld* world, AmeBodyHandle handle, bool held) {
+    if (!world || !world->world || world->world->IsLocked()) return;
+    AmePhysicsWorldState* st = world->state;
+    uint32_t si = resolve_slot(st, handle);
+    if (si == UINT32_MAX) return;
+    uint32_t d = st->slots[si].dense;
+    if (held) st->activation[d] |= AME_ACT_HELD;
+    else st->activation[d] &= (uint8_t)~AME_ACT_HELD;
+    st->bodies[d]->SetEnabled(!held && !(st->activation[d] & AME_ACT_PARKED));
+    // Owners teleport held bodies before unholding; the writeback must not see the old pose
+    if (!held) write_pose(st, d);
+}
+
+AmeTileChunkColliders* ame_physics_tile_chunks_create(AmePhysicsWorld* world,
+                                                      const int* tiles, int width, int height,
+                                                      float tile_size, int chunk_tiles) {
+    if (!world || !world->world || !world->state || !tiles || width <= 0 || height <= 0 || tile_size <= 0.0f) return NULL;
+    AmeTileChunkColliders* cs = new AmeTileChunkColliders();
+    cs->world = world;
+    cs->tiles.assign(tiles, tiles + (size_t)width * (size_t)height);
+    cs->width = width; cs->height = height;
+    cs->tile_size = tile_size;
+    cs->chunk_tiles = chunk_tiles > 0 ? chunk_tiles : 16;
+    cs->chunks_x = (width + cs->chunk_tiles - 1) / cs->chunk_tiles;
+    cs->chunks_y = (height + cs->chunk_tiles - 1) / cs->chunk_tiles;
+    size_t n = (size_t)cs->chunks_x * (size_t)cs->chunks_y;
+    cs->bodies.assign(n, nullptr);
+    cs->loaded.assign(n, 0);
+    world->state->chunk_sets.push_back(cs);
+    return cs;
+}
+
+void ame_physics_tile_chunks_destroy(AmeTileChunkColliders* chunks) {
+    if (!chunks) return;
+    AmePhysicsWorld* world = chunks->world;
+    for (b2Body* b : chunks->bodies) {
+        if (b) world->world->DestroyBody(b);
+    }
+    auto& sets = world->state->chunk_sets;
+    sets.erase(std::remove(sets.begin(), sets.end(), chunks), sets.end());
+    delete chunks;
+}
+
+size_t ame_physics_tile_chunks_loaded(const AmeTileChunkColliders* chunks) {
+    return chunks ? chunks->loaded_count : 0;
+}
+
+} // extern "C"
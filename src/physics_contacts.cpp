@@ -0,0 +1,103 @@
+#include "physics_internal.h"
+#include <utility>
+
+using namespace ame_physics_detail;
+
+// Records into `pending` during Step (and during DestroyBody/SetEnabled between steps); the
+// step swaps it with `published`. Both buffers are reserved up front and never grow.
+struct AmeContactRecorder : public b2ContactListener {
+    AmePhysicsWorldState* st = nullptr;
+    size_t capacity = 0;
+    std::vector<AmeContactEvent> pending, published;
+    uint32_t pending_dropped = 0, published_dropped = 0;
+
+    void record(b2Contact* contact, bool begin) {
+        if (pending.size() >= capacity) { pending_dropped++; return; }
+        b2Fixture* fa = contact->GetFixtureA();
+        b2Fixture* fb = contact->GetFixtureB();
+        const b2Body* ba = fa->GetBody();
+        const b2Body* bb = fb->GetBody();
+        bool trigger = fa->IsSensor() || fb->IsSensor();
+
+        AmeContactEvent ev = {};
+        ev.type = (uint8_t)(trigger ? (begin ? AME_TRIGGER_ENTER : AME_TRIGGER_EXIT)
+                                    : (begin ? AME_CONTACT_BEGIN : AME_CONTACT_END));
+        resolve(ba, &ev.body_a, &ev.entity_a);
+        resolve(bb, &ev.body_b, &ev.entity_b);
+        if (begin && !trigger) {
+            int32_t n = contact->GetManifold()->pointCount;
+            if (n > 0) {
+                b2WorldManifold wm;
+                contact->GetWorldManifold(&wm);
+                ev.point_x = wm.points[0].x; ev.point_y = wm.points[0].y;
+                ev.normal_x = wm.normal.x; ev.normal_y = wm.normal.y;
+                ev.point_count = (uint8_t)n;
+            }
+        }
+        pending.push_back(ev);
+    }
+
+    void resolve(const b2Body* body, AmeBodyHandle* out_handle, uint64_t* out_entity) const {
+        auto it = st->slot_by_body.find(body);
+        if (it == st->slot_by_body.end()) return;
+        const AmeBodySlot& s = st->slots[it->second];
+        *out_handle = make_handle(it->second, s.generation);
+        *out_entity = st->entity[s.dense];
+    }
+
+    void BeginContact(b2Contact* contact) override { record(contact, true); }
+    void EndContact(b2Contact* contact) override { record(contact, false); }
+};
+
+namespace ame_physics_detail {
+
+void publish_contact_events(AmePhysicsWorldState* st) {
+    if (!st || !st->contacts) return;
+    AmeContactRecorder* r = st->contacts;
+    std::swap(r->pending, r->published);
+    r->pending.clear();
+    r->published_dropped = r->pending_dropped;
+    r->pending_dropped = 0;
+}
+
+void destroy_contact_recorder(AmePhysicsWorldState* st) {
+    if (!st) return;
+    delete st->contacts;
+    st->contacts = nullptr;
+}
+
+} // namespace ame_physics_detail
+
+extern "C" {
+
+void ame_physics_contact_events_enable(AmePhysicsWorld* world, size_t capacity) {
+    if (!world || !world->world || !world->state) return;
+    AmePhysicsWorldState* st = world->state;
+    if (capacity == 0) {
+        world->world->SetContactListener(nullptr);
+        destroy_contact_recorder(st);
+        return;
+    }
+    if (!st->contacts) {
+        st->contacts = new AmeContactRecorder();
+        st->contacts->st = st;
+    }
+    AmeContactRecorder* r = st->contacts;
+    r->capacity = capacity;
+    r->pending.reserve(capacity);
+    r->published.reserve(capacity);
+    world->world->SetContactListener(r);
+}
+
+const AmeContactEvent* ame_physics_get_contact_events(const AmePhysicsWorld* world,
+                                                     size_t* out_count, uint32_t* out_dropped) {
+    if (out_count) *out_count = 0;
+    if (out_dropped) *out_dropped = 0;
+    if (!world || !world->state || !world->state->contacts) return NULL;
+    const AmeContactRecorder* r = world->state->contacts;
+    if (out_count) *out_count = r->published.size();
+    if (out_dropped) *out_dropped = r->published_dropped;
+    return r->published.empty() ? NULL : r->published.data();
+}
+
+} // extern "C"
@@ -0,0 +1,116 @@
+// Internal physics world state shared by the physics translation units (C++ only)
+#pragma once
+
+#include "ame/physics.h"
+#include <box2d/box2d.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+struct AmeTileChunkColliders;
+struct AmeContactRecorder;
+
+// Per-body activation bits (AmePhysicsWorldState::activation)
+enum : uint8_t {
+    AME_ACT_ALWAYS = 1u << 0,   // never parked by the activation manager
+    AME_ACT_PARKED = 1u << 1,   // disabled because no focus is near
+    AME_ACT_HELD = 1u << 2      // disabled by its owner (ame_physics_body_set_held)
+};
+
+struct AmeBodySlot {
+    b2Body* body = nullptr;
+    uint32_t generation = 1;
+    uint32_t dense = UINT32_MAX;      // index into the pose arrays, UINT32_MAX when free
+    uint32_t next_free = UINT32_MAX;
+};
+
+struct AmePhysicsWorldState {
+    // Registry
+    std::vector<AmeBodySlot> slots;
+    uint32_t free_head = UINT32_MAX;
+    std::unordered_map<const b2Body*, uint32_t> slot_by_body;
+    std::unordered_map<uint64_t, uint32_t> slot_by_entity;
+
+    // Dense SoA pose cache, one entry per live slot
+    std::vector<b2Body*> bodies;
+    std::vector<uint32_t> dense_slot;
+    std::vector<float> x, y, angle, vx, vy;
+    std::vector<uint8_t> awake;
+    std::vector<uint64_t> entity;
+    std::vector<AmeBodyHandle> handle;
+    std::vector<uint8_t> activation;  // AME_ACT_* bits
+
+    // Region activation (physics_activation.cpp)
+    float act_enter_margin = 64.0f;
+    float act_exit_margin = 128.0f;
+    uint32_t parked_count = 0;
+    std::vector<AmeTileChunkColliders*> chunk_sets;
+
+    // Contact event stream (physics_contacts.cpp); null until enabled
+    AmeContactRecorder* contacts = nullptr;
+
+    // Post-step callback; always invoked on the thread that called the step function
+    AmePhysicsStepCallback post_step = nullptr;
+    void* post_step_user = nullptr;
+
+    // Counters for ame_physics_get_stats
+    uint64_t step_count = 0;
+    float wall_step_ms = 0.0f;
+    // Queries may run concurrently from reader threads (audio, AI); reset every step
+    std::atomic<uint32_t> raycast_count{0};
+    std::atomic<uint64_t> raycast_ns{0};
+};
+
+namespace ame_physics_detail {
+
+inline AmeBodyHandle make_handle(uint32_t slot, uint32_t generation) {
+    return ((AmeBodyHandle)generation << 32) | (AmeBodyHandle)(slot + 1u);
+}
+
+// Slot index for a live handle, or UINT32_MAX
+inline uint32_t resolve_slot(const AmePhysicsWorldState* st, AmeBodyHandle h) {
+    if (!st || h == AME_BODY_HANDLE_INVALID) return UINT32_MAX;
+    uint32_t idx = (uint32_t)(h & 0xFFFFFFFFu);
+    if (idx == 0 || idx > st->slots.size()) return UINT32_MAX;
+    const AmeBodySlot& s = st->slots[idx - 1];
+    if (!s.body || s.generation != (uint32_t)(h >> 32)) return UINT32_MAX;
+    return idx - 1;
+}
+
+// Entity linked to a body, 0 when unknown
+inline uint64_t entity_of(const AmePhysicsWorldState* st, const b2Body* body) {
+    if (!st || !body) return 0;
+    auto it = st->slot_by_body.find(body);
+    if (it == st->slot_by_body.end()) return 0;
+    return st->entity[st->slots[it->second].dense];
+}
+
+using stat_clock = std::chrono::steady_clock;
+
+// Accumulates one query into the raycast counters
+struct RaycastTimer {
+    AmePhysicsWorldState* st;
+    stat_clock::time_point t0;
+    explicit RaycastTimer(AmePhysicsWorldState* s) : st(s), t0(stat_clock::now()) {}
+    ~RaycastTimer() {
+        if (!st) return;
+        uint64_t ns = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(stat_clock::now() - t0).count();
+        st->raycast_count.fetch_add(1, std::memory_order_relaxed);
+        st->raycast_ns.fetch_add(ns, std::memory_order_relaxed);
+    }
+};
+
+void unregister_body(AmePhysicsWorldState* st, const b2Body* body);
+void destroy_tile_chunk_sets(AmePhysicsWorldState* st);
+
+// Swap recorded contact events into the published buffer (after Step)
+void publish_contact_events(AmePhysicsWorldState* st);
+void destroy_contact_recorder(AmePhysicsWorldState* st);
+
+void refresh_poses(AmePhysicsWorldState* st);
+// Cache one body's current pose (dense index), e.g. after a teleport between steps
+void write_pose(AmePhysicsWorldState* st, uint32_t d);
+
+} // namespace ame_physics_detail
@@ -0,0 +1,201 @@
+#include "physics_internal.h"
+#include <algorithm>
+
+using namespace ame_physics_detail;
+
+namespace {
+
+bool passes(const b2Fixture* f, const AmeQueryFilter* filter) {
+    if (!filter) return !f->IsSensor();
+    if (f->IsSensor() && !filter->include_sensors) return false;
+    uint16_t mask = filter->category_mask ? filter->category_mask : 0xFFFFu;
+    return (f->GetFilterData().categoryBits & mask) != 0;
+}
+
+void fill_body(const AmePhysicsWorldState* st, b2Fixture* f, AmeQueryHit* hit) {
+    b2Body* body = f->GetBody();
+    hit->body = body;
+    hit->user_data = reinterpret_cast<void*>(body->GetUserData().pointer);
+    hit->handle = AME_BODY_HANDLE_INVALID;
+    hit->entity = 0;
+    if (!st) return;
+    auto it = st->slot_by_body.find(body);
+    if (it == st->slot_by_body.end()) return;
+    const AmeBodySlot& s = st->slots[it->second];
+    hit->handle = make_handle(it->second, s.generation);
+    hit->entity = st->entity[s.dense];
+}
+
+class AabbQuery : public b2QueryCallback {
+public:
+    AabbQuery(const AmePhysicsWorldState* st, const b2AABB& box, const AmeQueryFilter* filter,
+              AmeQueryHit* hits, size_t capacity, bool count_all)
+        : st(st), box(box), filter(filter), hits(hits), capacity(capacity), count_all(count_all) {}
+
+    bool ReportFixture(b2Fixture* f) override {
+        if (!passes(f, filter)) return true;
+        // The tree holds fattened AABBs; confirm against the fixture's tight per-child boxes
+        bool overlap = false;
+        for (int32_t c = 0, n = f->GetShape()->GetChildCount(); c < n && !overlap; ++c)
+            overlap = b2TestOverlap(f->GetAABB(c), box);
+        if (!overlap) return true;
+        if (count < capacity) {
+            AmeQueryHit& h = hits[count];
+            h = AmeQueryHit{};
+            fill_body(st, f, &h);
+        }
+        count++;
+        return count_all || count < capacity;
+    }
+
+    const AmePhysicsWorldState* st;
+    b2AABB box;
+    const AmeQueryFilter* filter;
+    AmeQueryHit* hits;
+    size_t capacity;
+    bool count_all;
+    size_t count = 0;
+};
+
+class ShapeCastQuery : public b2QueryCallback {
+public:
+    ShapeCastQuery(const AmePhysicsWorldState* st, const b2Shape* shape, const b2Transform& xf,
+                   const b2Vec2& translation, const b2AABB& swept, const AmeQueryFilter* filter,
+                   AmeQueryHit* hits, size_t capacity)
+        : st(st), shape(shape), xf(xf), translation(translation), swept(swept), filter(filter),
+          hits(hits), capacity(capacity) {}
+
+    bool ReportFixture(b2Fixture* f) override {
+        if (!passes(f, filter)) return true;
+        const b2Shape* target = f->GetShape();
+        const b2Transform& body_xf = f->GetBody()->GetTransform();
+        // One hit per fixture: the nearest of its children (chain segments, edges)
+        AmeQueryHit best = {};
+        bool found = false;
+        for (int32_t c = 0, n = target->GetChildCount(); c < n; ++c) {
+            if (!b2TestOverlap(f->GetAABB(c), swept)) continue;
+            AmeQueryHit h = {};
+            // b2ShapeCast reports no hit for shapes that already overlap at the start
+            if (b2TestOverlap(target, c, shape, 0, body_xf, xf)) {
+                h.point_x = xf.p.x; h.point_y = xf.p.y;
+                h.fraction = 0.0f;
+            } else {
+                b2ShapeCastInput in;
+                in.proxyA.Set(target, c);
+                in.proxyB.Set(shape, 0);
+                in.transformA = body_xf;
+                in.transformB = xf;
+                in.translationB = translation;
+                b2ShapeCastOutput out;
+                if (!b2ShapeCast(&out, &in) || out.lambda > 1.0f) continue;
+                h.point_x = out.point.x; h.point_y = out.point.y;
+                h.normal_x = out.normal.x; h.normal_y = out.normal.y;
+                h.fraction = out.lambda;
+            }
+            if (!found || h.fraction < best.fraction) { best = h; found = true; }
+            if (best.fraction == 0.0f) break; // nothing is nearer than a start overlap
+        }
+        if (found) insert(f, best);
+        return true;
+    }
+
+    // Keep the closest `capacity` hits sorted by fraction
+    void insert(b2Fixture* f, AmeQueryHit& h) {
+        if (capacity == 0) return;
+        if (count == capacity && h.fraction >= hits[count - 1].fraction) return;
+        fill_body(st, f, &h);
+        size_t i = count < capacity ? count++ : capacity - 1;
+        while (i > 0 && hits[i - 1].fraction > h.fraction) { hits[i] = hits[i - 1]; --i; }
+        hits[i] = h;
+    }
+
+    const AmePhysicsWorldState* st;
+    const b2Shape* shape;
+    b2Transform xf;
+    b2Vec2 translation;
+    b2AABB swept;
+    const AmeQueryFilter* filter;
+    AmeQueryHit* hits;
+    size_t capacity;
+    size_t count = 0;
+};
+
+b2AABB make_aabb(float min_x, float min_y, float max_x, float max_y) {
+    b2AABB box;
+    box.lowerBound.Set(std::min(min_x, max_x), std::min(min_y, max_y));
+    box.upperBound.Set(std::max(min_x, max_x), std::max(min_y, max_y));
+    return box;
+}
+
+} // namespace
+
+extern "C" {
+
+size_t ame_physics_query_aabb(const AmePhysicsWorld* world,
+                              float min_x, float min_y, float max_x, float max_y,
+                              const AmeQueryFilter* filter,
+                              AmeQueryHit* out_hits, size_t capacity, size_t* out_total) {
+    if (out_total) *out_total = 0;
+    if (!world || !world->world || (!out_hits && capacity)) return 0;
+    if (capacity == 0 && !out_total) return 0;
+    AabbQuery q(world->state, make_aabb(min_x, min_y, max_x, max_y), filter, out_hits, capacity, out_total != NULL);
+    world->world->QueryAABB(&q, q.box);
+    if (out_total) *out_total = q.count;
+    return std::min(q.count, capacity);
+}
+
+void ame_physics_query_aabb_batch(const AmePhysicsWorld* world,
+                                  const AmeAabbQuery* queries, size_t query_count,
+                                  const AmeQueryFilter* filter,
+                                  AmeQueryHit* out_hits, size_t capacity_per_query, size_t* out_counts) {
+    if (!queries || !out_counts) return;
+    for (size_t i = 0; i < query_count; ++i) {
+        const AmeAabbQuery& q = queries[i];
+        out_counts[i] = ame_physics_query_aabb(world, q.min_x, q.min_y, q.max_x, q.max_y, filter,
+                                               out_hits ? out_hits + i * capacity_per_query : NULL,
+                                               capacity_per_query, NULL);
+    }
+}
+
+size_t ame_physics_shape_cast(const AmePhysicsWorld* world, const AmeShapeCast* cast,
+                              const AmeQueryFilter* filter,
+                              AmeQueryHit* out_hits, size_t capacity) {
+    if (!world || !world->world || !cast || !out_hits || capacity == 0) return 0;
+    b2PolygonShape box;
+    b2CircleShape circle;
+    const b2Shape* shape;
+    if (cast->type == AME_QUERY_CIRCLE) {
+        if (cast->radius <= 0.0f) return 0;
+        circle.m_radius = cast->radius;
+        shape = &circle;
+    } else {
+        if (cast->half_w <= 0.0f || cast->half_h <= 0.0f) return 0;
+        box.SetAsBox(cast->half_w, cast->half_h);
+        shape = &box;
+    }
+    b2Transform xf(b2Vec2(cast->x, cast->y), b2Rot(cast->angle));
+    b2AABB start, end;
+    shape->ComputeAABB(&start, xf, 0);
+    end = start;
+    end.lowerBound.Set(start.lowerBound.x + cast->dx, start.lowerBound.y + cast->dy);
+    end.upperBound.Set(start.upperBound.x + cast->dx, start.upperBound.y + cast->dy);
+    b2AABB swept = make_aabb(std::min(start.lowerBound.x, end.lowerBound.x), std::min(start.lowerBound.y, end.lowerBound.y),
+                             std::max(start.upperBound.x, end.upperBound.x), std::max(start.upperBound.y, end.upperBound.y));
+    ShapeCastQuery q(world->state, shape, xf, b2Vec2(cast->dx, cast->dy), swept, filter, out_hits, capacity);
+    world->world->QueryAABB(&q, swept);
+    return q.count;
+}
+
+void ame_physics_shape_cast_batch(const AmePhysicsWorld* world,
+                                  const AmeShapeCast* casts, size_t cast_count,
+                                  const AmeQueryFilter* filter,
+                                  AmeQueryHit* out_hits, size_t capacity_per_cast, size_t* out_counts) {
+    if (!casts || !out_counts) return;
+    for (size_t i = 0; i < cast_count; ++i) {
+        out_counts[i] = out_hits ? ame_physics_shape_cast(world, &casts[i], filter,
+                                                          out_hits + i * capacity_per_cast, capacity_per_cast)
+                                 : 0;
+    }
+}
+
+} // extern "C"
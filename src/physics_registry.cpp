@@ -0,0 +1,188 @@
+#include "physics_internal.h"
+
+using namespace ame_physics_detail;
+
+namespace ame_physics_detail {
+
+void write_pose(AmePhysicsWorldState* st, uint32_t d) {
+    const b2Body* b = st->bodies[d];
+    const b2Vec2& p = b->GetPosition();
+    const b2Vec2& v = b->GetLinearVelocity();
+    st->x[d] = p.x; st->y[d] = p.y;
+    st->angle[d] = b->GetAngle();
+    st->vx[d] = v.x; st->vy[d] = v.y;
+    st->awake[d] = b->IsAwake() ? 1 : 0;
+}
+
+void unregister_body(AmePhysicsWorldState* st, const b2Body* body) {
+    if (!st || !body) return;
+    auto it = st->slot_by_body.find(body);
+    if (it == st->slot_by_body.end()) return;
+    uint32_t si = it->second;
+    st->slot_by_body.erase(it);
+    AmeBodySlot& s = st->slots[si];
+    uint32_t d = s.dense;
+    uint64_t ent = st->entity[d];
+    if (ent) {
+        auto e = st->slot_by_entity.find(ent);
+        if (e != st->slot_by_entity.end() && e->second == si) st->slot_by_entity.erase(e);
+    }
+    if (st->activation[d] & AME_ACT_PARKED) st->parked_count--;
+    // Swap-remove from the dense arrays
+    uint32_t last = (uint32_t)st->bodies.size() - 1;
+    if (d != last) {
+        st->bodies[d] = st->bodies[last];
+        st->dense_slot[d] = st->dense_slot[last];
+        st->x[d] = st->x[last]; st->y[d] = st->y[last]; st->angle[d] = st->angle[last];
+        st->vx[d] = st->vx[last]; st->vy[d] = st->vy[last];
+        st->awake[d] = st->awake[last];
+        st->entity[d] = st->entity[last];
+        st->handle[d] = st->handle[last];
+        st->activation[d] = st->activation[last];
+        st->slots[st->dense_slot[d]].dense = d;
+    }
+    st->bodies.pop_back(); st->dense_slot.pop_back();
+    st->x.pop_back(); st->y.pop_back(); st->angle.pop_back();
+    st->vx.pop_back(); st->vy.pop_back(); st->awake.pop_back();
+    st->entity.pop_back(); st->handle.pop_back(); st->activation.pop_back();
+
+    s.body = nullptr;
+    s.dense = UINT32_MAX;
+    s.generation++;
+    if (s.generation == 0) s.generation = 1;
+    s.next_free = st->free_head;
+    st->free_head = si;
+}
+
+void refresh_poses(AmePhysicsWorldState* st) {
+    if (!st) return;
+    const uint32_t n = (uint32_t)st->bodies.size();
+    if (st->parked_count == 0) {
+        for (uint32_t d = 0; d < n; ++d) write_pose(st, d);
+        return;
+    }
+    // Parked bodies cannot move; their cached pose is still the one they were parked with
+    for (uint32_t d = 0; d < n; ++d) {
+        if (!(st->activation[d] & AME_ACT_PARKED)) write_pose(st, d);
+    }
+}
+
+} // namespace ame_physics_detail
+
+extern "C" {
+
+AmeBodyHandle ame_physics_register_body(AmePhysicsWorld* world, b2Body* body, uint64_t entity) {
+    if (!world || !world->state || !body) return AME_BODY_HANDLE_INVALID;
+    AmePhysicsWorldState* st = world->state;
+    auto found = st->slot_by_body.find(body);
+    if (found != st->slot_by_body.end()) {
+        AmeBodyHandle h = make_handle(found->second, st->slots[found->second].generation);
+        if (entity) ame_physics_body_set_entity(world, h, entity);
+        return h;
+    }
+    uint32_t si;
+    if (st->free_head != UINT32_MAX) {
+        si = st->free_head;
+        st->free_head = st->slots[si].next_free;
+    } else {
+        si = (uint32_t)st->slots.size();
+        st->slots.emplace_back();
+    }
+    AmeBodySlot& s = st->slots[si];
+    s.body = body;
+    s.next_free = UINT32_MAX;
+    s.dense = (uint32_t)st->bodies.size();
+    AmeBodyHandle h = make_handle(si, s.generation);
+
+    st->bodies.push_back(body); st->dense_slot.push_back(si);
+    st->x.push_back(0.0f); st->y.push_back(0.0f); st->angle.push_back(0.0f);
+    st->vx.push_back(0.0f); st->vy.push_back(0.0f); st->awake.push_back(0);
+    st->entity.push_back(0); st->handle.push_back(h); st->activation.push_back(0);
+    write_pose(st, s.dense);
+    st->slot_by_body[body] = si;
+    if (entity) ame_physics_body_set_entity(world, h, entity);
+    return h;
+}
+
+AmeBodyHandle ame_physics_body_handle(const AmePhysicsWorld* world, const b2Body* body) {
+    if (!world || !world->state || !body) return AME_BODY_HANDLE_INVALID;
+    const AmePhysicsWorldState* st = world->state;
+    auto it = st->slot_by_body.find(body);
+    if (it == st->slot_by_body.end()) return AME_BODY_HANDLE_INVALID;
+    return make_handle(it->second, st->slots[it->second].generation);
+}
+
+b2Body* ame_physics_body_get(const AmePhysicsWorld* world, AmeBodyHandle handle) {
+    if (!world) return nullptr;
+    uint32_t si = resolve_slot(world->state, handle);
+    return si == UINT32_MAX ? nullptr : world->state->slots[si].body;
+}
+
+bool ame_physics_body_valid(const AmePhysicsWorld* world, AmeBodyHandle handle) {
+    return world && resolve_slot(world->state, handle) != UINT32_MAX;
+}
+
+void ame_physics_destroy_body_handle(AmePhysicsWorld* world, AmeBodyHandle handle) {
+    b2Body* body = ame_physics_body_get(world, handle);
+    if (body) ame_physics_destroy_body(world, body);
+}
+
+void ame_physics_body_set_entity(AmePhysicsWorld* world, AmeBodyHandle handle, uint64_t entity) {
+    if (!world) return;
+    AmePhysicsWorldState* st = world->state;
+    uint32_t si = resolve_slot(st, handle);
+    if (si == UINT32_MAX) return;
+    uint32_t d = st->slots[si].dense;
+    uint64_t prev = st->entity[d];
+    if (prev == entity) return;
+    if (prev) {
+        auto e = st->slot_by_entity.find(prev);
+        if (e != st->slot_by_entity.end() && e->second == si) st->slot_by_entity.erase(e);
+    }
+    st->entity[d] = entity;
+    if (entity) st->slot_by_entity[entity] = si;
+}
+
+uint64_t ame_physics_body_entity(const AmePhysicsWorld* world, AmeBodyHandle handle) {
+    if (!world) return 0;
+    uint32_t si = resolve_slot(world->state, handle);
+    if (si == UINT32_MAX) return 0;
+    return world->state->entity[world->state->slots[si].dense];
+}
+
+AmeBodyHandle ame_physics_entity_body(const AmePhysicsWorld* world, uint64_t entity) {
+    if (!world || !world->state || !entity) return AME_BODY_HANDLE_INVALID;
+    const AmePhysicsWorldState* st = world->state;
+    auto it = st->slot_by_entity.find(entity);
+    if (it == st->slot_by_entity.end()) return AME_BODY_HANDLE_INVALID;
+    return make_handle(it->second, st->slots[it->second].generation);
+}
+
+AmePhysicsPoses ame_physics_get_poses(const AmePhysicsWorld* world) {
+    AmePhysicsPoses p = {};
+    if (!world || !world->state) return p;
+    const AmePhysicsWorldState* st = world->state;
+    p.count = st->bodies.size();
+    if (p.count == 0) return p;
+    p.x = st->x.data(); p.y = st->y.data(); p.angle = st->angle.data();
+    p.vx = st->vx.data(); p.vy = st->vy.data();
+    p.awake = st->awake.data();
+    p.entity = st->entity.data();
+    p.handle = st->handle.data();
+    return p;
+}
+
+bool ame_physics_body_pose(const AmePhysicsWorld* world, AmeBodyHandle handle,
+                           AmeTransform2D* out_transform, float* out_vx, float* out_vy) {
+    if (!world) return false;
+    const AmePhysicsWorldState* st = world->state;
+    uint32_t si = resolve_slot(st, handle);
+    if (si == UINT32_MAX) return false;
+    uint32_t d = st->slots[si].dense;
+    if (out_transform) { out_transform->x = st->x[d]; out_transform->y = st->y[d]; out_transform->angle = st->angle[d]; }
+    if (out_vx) *out_vx = st->vx[d];
+    if (out_vy) *out_vy = st->vy[d];
+    return true;
+}
+
+} // extern "C"
@@ -0,0 +1,179 @@
+#include "ame/profiler.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+using prof_clock = std::chrono::steady_clock;
+
+constexpr uint64_t kRingCapacity = 1u << 16; // events per thread (1 MiB)
+constexpr int kMaxTrackedDepth = 64;
+
+// One span edge; name == nullptr marks an end. Fields are relaxed atomics so a dump may read a
+// ring while its owner keeps writing.
+struct Event {
+    std::atomic<const char*> name{nullptr};
+    std::atomic<uint64_t> ts_ns{0};
+};
+
+struct Ring {
+    Event events[kRingCapacity];
+    std::atomic<uint64_t> head{0};  // total events written; only the owner thread stores
+    std::atomic<uint64_t> floor{0}; // events below this index were cleared
+    int tid = 0;
+    std::string thread_name;        // guarded by g_registry_mutex
+};
+
+std::atomic<bool> g_enabled{false};
+const prof_clock::time_point g_epoch = prof_clock::now();
+
+// Rings live until exit so a dump can still read threads that have finished
+std::mutex g_registry_mutex;
+std::vector<std::unique_ptr<Ring>> g_rings;
+
+thread_local Ring* t_ring = nullptr;
+thread_local int t_depth = 0;
+thread_local uint64_t t_recorded = 0; // bit d: the begin at depth d was recorded
+
+Ring* thread_ring() {
+    if (t_ring) return t_ring;
+    auto ring = std::make_unique<Ring>();
+    std::lock_guard<std::mutex> lock(g_registry_mutex);
+    ring->tid = (int)g_rings.size() + 1;
+    t_ring = ring.get();
+    g_rings.push_back(std::move(ring));
+    return t_ring;
+}
+
+inline uint64_t now_ns() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(prof_clock::now() - g_epoch).count();
+}
+
+inline void push_event(const char* name) {
+    Ring* r = thread_ring();
+    uint64_t h = r->head.load(std::memory_order_relaxed);
+    Event& e = r->events[h & (kRingCapacity - 1)];
+    e.name.store(name, std::memory_order_relaxed);
+    e.ts_ns.store(now_ns(), std::memory_order_relaxed);
+    r->head.store(h + 1, std::memory_order_release);
+}
+
+void write_json_string(FILE* f, const char* s) {
+    std::fputc('"', f);
+    for (; *s; ++s) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') { std::fputc('\\', f); std::fputc(c, f); }
+        else if (c < 0x20) std::fprintf(f, "\\u%04x", c);
+        else std::fputc(c, f);
+    }
+    std::fputc('"', f);
+}
+
+struct Copied { const char* name; uint64_t ts_ns; };
+
+// Snapshot of one ring, oldest first. Entries the owner may have overwritten while copying
+// (indices below the head re-read afterwards minus capacity) are dropped.
+std::vector<Copied> copy_ring(const Ring& r) {
+    std::vector<Copied> out;
+    uint64_t head = r.head.load(std::memory_order_acquire);
+    uint64_t first = head > kRingCapacity ? head - kRingCapacity : 0;
+    uint64_t floor = r.floor.load(std::memory_order_relaxed);
+    if (floor > first) first = floor;
+    out.reserve((size_t)(head - first));
+    for (uint64_t i = first; i < head; ++i) {
+        const Event& e = r.events[i & (kRingCapacity - 1)];
+        out.push_back({ e.name.load(std::memory_order_relaxed), e.ts_ns.load(std::memory_order_relaxed) });
+    }
+    uint64_t head_after = r.head.load(std::memory_order_acquire);
+    if (head_after - first > kRingCapacity) {
+        size_t lost = (size_t)(head_after - first - kRingCapacity);
+        out.erase(out.begin(), out.begin() + (lost < out.size() ? lost : out.size()));
+    }
+    return out;
+}
+
+} // namespace
+
+extern "C" {
+
+void ame_profiler_set_enabled(bool enabled) {
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool ame_profiler_enabled(void) {
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+void ame_profiler_begin(const char* name) {
+    int d = t_depth++;
+    bool rec = name && g_enabled.load(std::memory_order_relaxed);
+    if (d >= kMaxTrackedDepth) return;
+    if (rec) { t_recorded |= (uint64_t)1 << d; push_event(name); }
+    else t_recorded &= ~((uint64_t)1 << d);
+}
+
+void ame_profiler_end(void) {
+    if (t_depth <= 0) return;
+    int d = --t_depth;
+    if (d >= kMaxTrackedDepth || !(t_recorded & ((uint64_t)1 << d))) return;
+    t_recorded &= ~((uint64_t)1 << d);
+    push_event(nullptr);
+}
+
+void ame_profiler_set_thread_name(const char* name) {
+    Ring* r = thread_ring();
+    std::lock_guard<std::mutex> lock(g_registry_mutex);
+    r->thread_name = name ? name : "";
+}
+
+void ame_profiler_clear(void) {
+    std::lock_guard<std::mutex> lock(g_registry_mutex);
+    for (auto& r : g_rings) r->floor.store(r->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+}
+
+size_t ame_profiler_event_count(void) {
+    std::lock_guard<std::mutex> lock(g_registry_mutex);
+    size_t n = 0;
+    for (auto& r : g_rings) {
+        uint64_t head = r->head.load(std::memory_order_acquire);
+        uint64_t first = head > kRingCapacity ? head - kRingCapacity : 0;
+        uint64_t floor = r->floor.load(std::memory_order_relaxed);
+        n += (size_t)(head - (floor > first ? floor : first));
+    }
+    return n;
+}
+
+bool ame_profiler_write_chrome_trace(const char* path) {
+    if (!path) return false;
+    FILE* f = std::fopen(path, "wb");
+    if (!f) return false;
+    std::lock_guard<std::mutex> lock(g_registry_mutex);
+    std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", f);
+    bool first = true;
+    for (auto& r : g_rings) {
+        std::fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":",
+                     first ? "" : ",\n", r->tid);
+        first = false;
+        if (!r->thread_name.empty()) write_json_string(f, r->thread_name.c_str());
+        else std::fprintf(f, "\"thread %d\"", r->tid);
+        std::fputs("}}", f);
+        for (const Copied& e : copy_ring(*r)) {
+            // ts in microseconds; ends carry no name
+            std::fprintf(f, ",\n{\"ph\":\"%c\",\"pid\":1,\"tid\":%d,\"ts\":%.3f", e.name ? 'B' : 'E', r->tid,
+                         (double)e.ts_ns / 1000.0);
+            if (e.name) { std::fputs(",\"name\":", f); write_json_string(f, e.name); }
+            std::fputc('}', f);
+        }
+    }
+    std::fputs("\n]}\n", f);
+    bool ok = !std::ferror(f);
+    return std::fclose(f) == 0 && ok;
+}
+
+} // extern "C"
@@ -2,10 +2,16 @@
 #include "unitylike/Scene.h"
 #include "unitylike/TransformHierarchy.h"
 #include "ame/render_pipeline.h"
+#include "ame/jobs.h"
+#include "ame/profiler.h"
 #include <flecs.h>
 #include <vector>
 #include <algorithm>
-#include <map>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
 #include <glad/gl.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -58,6 +64,125 @@ namespace {
         float z;
     };
     
+    struct SpriteInfo {
+        AmeTransform2D transform;
+        SpriteData sprite;
+        ecs_entity_t entity;
+    };
+
+    // Queries are created once per world and reused every frame; Flecs keeps their table
+    // matches up to date, so a frame only walks the matched tables.
+    struct RpQueries {
+        ecs_query_t* camera = nullptr;
+        ecs_query_t* tilemap = nullptr;
+        ecs_query_t* sprite = nullptr;
+        ecs_query_t* mesh = nullptr;
+        ecs_query_t* text = nullptr;
+    };
+    static std::unordered_map<ecs_world_t*, RpQueries> g_rp_queries;
+
+    // Queries are entities and die with the world; only drop our pointers
+    static void rp_queries_forget(ecs_world_t* w, void* ctx) {
+        (void)ctx;
+        g_rp_queries.erase(w);
+    }
+
+    static RpQueries& rp_queries(ecs_world_t* w) {
+        auto found = g_rp_queries.find(w);
+        if (found != g_rp_queries.end()) return found->second;
+        RpQueries q;
+        {
+            ecs_query_desc_t d = {};
+            d.cache_kind = EcsQueryCacheAuto;
+            d.terms[0].id = g_comp.camera;
+            q.camera = ecs_query_init(w, &d);
+        }
+        {
+            ecs_query_desc_t d = {};
+            d.cache_kind = EcsQueryCacheAuto;
+            d.terms[0].id = g_comp.tilemap;
+            q.tilemap = ecs_query_init(w, &d);
+        }
+        {
+            ecs_query_desc_t d = {};
+            d.cache_kind = EcsQueryCacheAuto;
+            d.terms[0].id = g_comp.sprite;
+            d.terms[1].id = g_comp.transform;
+            d.terms[2].id = g_comp.world_transform; d.terms[2].oper = EcsOptional;
+            q.sprite = ecs_query_init(w, &d);
+        }
+        {
+            ecs_query_desc_t d = {};
+            d.cache_kind = EcsQueryCacheAuto;
+            d.terms[0].id = g_comp.mesh;
+            d.terms[1].id = g_comp.transform;
+            d.terms[2].id = g_comp.sprite;   d.terms[2].oper = EcsOptional;
+            d.terms[3].id = g_comp.material; d.terms[3].oper = EcsOptional;
+            q.mesh = ecs_query_init(w, &d);
+        }
+        {
+            ecs_query_desc_t d = {};
+            d.cache_kind = EcsQueryCacheAuto;
+            d.terms[0].id = g_comp.text;
+            d.terms[1].id = g_comp.transform;       d.terms[1].oper = EcsOptional;
+            d.terms[2].id = g_comp.world_transform; d.terms[2].oper = EcsOptional;
+            q.text = ecs_query_init(w, &d);
+        }
+        ecs_atfini(w, rp_queries_forget, nullptr);
+        return g_rp_queries.emplace(w, q).first->second;
+    }
+
+    // Tables without a parent (or the cached world transform) can use the local transform column
+    static bool table_has_parent(ecs_world_t* w, const ecs_table_t* table) {
+        return table && ecs_table_has_id(w, table, ecs_pair(EcsChildOf, EcsWildcard));
+    }
+
+    // One matched table of the sprite query; rows land in sprites[offset, offset + count)
+    struct SpriteChunk {
+        const SpriteData* sp;
+        const AmeTransform2D* tr;
+        const AmeWorldTransform2D* cached;
+        const ecs_entity_t* entities;
+        int count;
+        bool sp_self, tr_self, parented;
+        size_t offset;
+        size_t kept = 0;
+    };
+
+    struct SpriteExtract {
+        ecs_world_t* world;
+        SpriteChunk* chunks;
+        SpriteInfo* out;
+    };
+
+    // Below this many rows the jobs cost more than the copy
+    constexpr size_t kParallelSpriteRows = 4096;
+
+    static void extract_chunk(ecs_world_t* w, SpriteChunk& c, SpriteInfo* out, bool allow_parented) {
+        if (c.parented && !allow_parented) return;
+        SpriteInfo* dst = out + c.offset;
+        size_t kept = 0;
+        for (int i = 0; i < c.count; ++i) {
+            const SpriteData& sprite = c.sp[c.sp_self ? i : 0];
+            if (!sprite.visible) continue;
+            AmeTransform2D wt = c.tr[c.tr_self ? i : 0];
+            if (c.cached) {
+                wt = AmeTransform2D{ c.cached[i].x, c.cached[i].y, c.cached[i].angle };
+            } else if (c.parented) {
+                // Compose world transform using helper
+                AmeWorldTransform2D wtf = ameComputeWorldTransform(w, c.entities[i]);
+                wt = AmeTransform2D{ wtf.x, wtf.y, wtf.angle };
+            }
+            dst[kept++] = SpriteInfo{wt, sprite, c.entities[i]};
+        }
+        c.kept = kept;
+    }
+
+    static void extract_sprite_chunk(void* ctx, size_t index) {
+        SpriteExtract* x = (SpriteExtract*)ctx;
+        extract_chunk(x->world, x->chunks[index], x->out, false);
+    }
+
     // White fallback texture for sprites
     static GLuint g_white_texture = 0;
 
@@ -396,23 +521,15 @@ namespace {
         }
     }
 
-    // Render tilemap via shared compositor: gather layers and submit in one call
-    static void render_tilemap_layers_batch(ecs_world_t* w, float cam_x, float cam_y, float cam_zoom,
-                                            int viewport_w, int viewport_h, int* draw_calls) {
-        // Query all TilemapRefData components and sort by layer
-        ecs_query_desc_t qd = {};
-        qd.terms[0].id = g_comp.tilemap;
-        ecs_query_t* q = ecs_query_init(w, &qd);
+    // Gather valid TilemapRefData layers, sorted by layer (extract side: no GL)
+    static void gather_tile_layers(ecs_world_t* w, ecs_query_t* q, std::vector<TilemapRefData>& layers) {
+        layers.clear();
         ecs_iter_t it = ecs_query_iter(w, q);
-        struct TRef { TilemapRefData data; };
-        std::vector<TRef> layers;
         while (ecs_query_next(&it)) {
+            const TilemapRefData* col = ecs_field(&it, TilemapRefData, 0);
+            bool self = ecs_field_is_self(&it, 0);
             for (int i=0;i<it.count;i++){
-                const TilemapRefData* t = (const TilemapRefData*)ecs_get_id(w, it.entities[i], g_comp.tilemap);
-                if (!t) {
-                    SDL_Log("[TILEMAP] Entity %llu has NULL TilemapRefData", (unsigned long long)it.entities[i]);
-                    continue;
-                }
+                const TilemapRefData* t = &col[self ? i : 0];
                 // Debug log tilemap data
                 SDL_Log("[TILEMAP] Entity %llu: layer=%d atlas_tex=%u gid_tex=%u atlas=%dx%d tile=%dx%d firstgid=%d cols=%d map=%dx%d",
                        (unsigned long long)it.entities[i], t->layer, t->atlas_tex, t->gid_tex,
@@ -423,20 +540,24 @@ namespace {
                            (unsigned long long)it.entities[i], t->atlas_tex, t->gid_tex, (void*)t->map);
                     continue;
                 }
-                layers.push_back(TRef{ *t });
+                layers.push_back(*t);
             }
         }
-        ecs_query_fini(q);
+        std::sort(layers.begin(), layers.end(), [](const TilemapRefData& a, const TilemapRefData& b){ return a.layer < b.layer; });
+    }
+
+    // Render tilemap via shared compositor: submit all gathered layers in one call
+    static void render_tilemap_layers_batch(const std::vector<TilemapRefData>& layers, float cam_x, float cam_y, float cam_zoom,
+                                            int viewport_w, int viewport_h, int* draw_calls) {
         if (layers.empty()) {
             SDL_Log("[TILEMAP] No valid tilemap layers found for rendering");
             return;
         }
-        std::sort(layers.begin(), layers.end(), [](const TRef& a, const TRef& b){ return a.data.layer < b.data.layer; });
         // Build RP layers (cap at 16)
         AmeRP_TileLayer rp[16]; int cnt = (int)layers.size(); if (cnt>16) cnt=16;
         int map_w = 0, map_h = 0;
         for (int i=0;i<cnt;i++){
-            const TilemapRefData& t = layers[i].data;
+            const TilemapRefData& t = layers[i];
             rp[i].atlas_tex = t.atlas_tex;
             rp[i].gid_tex = t.gid_tex;
             rp[i].atlas_w = t.atlas_w;
@@ -456,7 +577,7 @@ namespace {
     }
     
     // Render sprite batch
-    static void render_sprite_batch(const SpriteBatch& batch, const glm::mat4& mvp, int* draw_calls) {
+    static void render_sprite_batch(const SpriteBatch& batch, GLuint texture, const glm::mat4& mvp, int* draw_calls) {
         if (batch.vertices.empty()) return;
         
         GLuint vao, vbo;
@@ -482,7 +603,7 @@ namespace {
         glUniform1i(g_sprite_tex_loc, 0);
         
         glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, batch.texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
         
         glDrawArrays(GL_TRIANGLES, 0, batch.vertices.size());
         if (draw_calls) { (*draw_calls)++; }
@@ -494,138 +615,119 @@ namespace {
     }
 }
 
-// Enhanced ECS rendering pipeline
-void ame_rp_run_ecs(ecs_world_t* w) {
-    if (!w) return;
+
+// Everything one frame draws, copied out of the world so drawing needs no ECS access.
+// Vectors keep their capacity across frames; each exchange slot reuses its own.
+struct AmeRenderSnapshot {
+    struct MeshDraw {
+        GLuint texture;        // 0: white fallback, resolved at draw
+        float parallax;
+        size_t first, count;   // vertices in mesh_vertices (8 floats each: pos, uv, color)
+    };
+
+    uint64_t tick = 0;         // 0 until the first extract
+    bool have_cam = false;
+    AmeCamera cam = {0};
+    std::vector<TilemapRefData> tile_layers;
+    std::vector<SpriteBatch> batches;   // only the first batch_count are live
+    size_t batch_count = 0;
+    int sprites_seen = 0;
+    std::vector<MeshDraw> meshes;
+    std::vector<float> mesh_vertices;
+    std::vector<AmeRenderText> texts;
+    std::vector<char> text_chars;       // NUL-terminated strings the texts point into
+};
+
+namespace {
+
+// Fill snap from the world and stamp it with `tick`. Touches no GL state, so it may run on the
+// logic thread.
+void extract_snapshot(ecs_world_t* w, AmeRenderSnapshot& snap, uint64_t tick) {
+    AmeProfileScope prof_extract("rp.extract");
     ensure_components_registered(w);
-    init_shaders();
-    init_fallback_textures();
-    init_white_texture();
-    
-    // Per-frame counters
-    int dc_draw_calls = 0;
-    int dc_tilemaps = 0;
-    int dc_sprites_seen = 0;
-    int dc_batches = 0;
-    int dc_missing_sprite = 0;
-    int dc_missing_transform = 0;
-    const int kMaxMissingLogs = 8;
-    
+    snap.tick = tick;
+    snap.have_cam = false;
+    snap.tile_layers.clear();
+    snap.batch_count = 0;
+    snap.sprites_seen = 0;
+    snap.meshes.clear();
+    snap.mesh_vertices.clear();
+    snap.texts.clear();
+    snap.text_chars.clear();
+
+    RpQueries& queries = rp_queries(w);
+    // No-op unless a transform changed since the propagation system last ran
+    ameUpdateWorldTransforms(w);
+
     // Find primary camera
-    AmeCamera cam = {0};
-    bool have_cam = false;
-    
-    ecs_query_desc_t cam_query_desc = {};
-    cam_query_desc.terms[0].id = g_comp.camera;
-    ecs_query_t* cam_query = ecs_query_init(w, &cam_query_desc);
-    ecs_iter_t cam_iter = ecs_query_iter(w, cam_query);
-    
+    ecs_iter_t cam_iter = ecs_query_iter(w, queries.camera);
     while (ecs_query_next(&cam_iter)) {
+        const AmeCamera* cams = ecs_field(&cam_iter, AmeCamera, 0);
+        bool cam_self = ecs_field_is_self(&cam_iter, 0);
         for (int i = 0; i < cam_iter.count; ++i) {
-            AmeCamera* cptr = (AmeCamera*)ecs_get_id(w, cam_iter.entities[i], g_comp.camera);
-            if (cptr && cptr->viewport_w > 0 && cptr->viewport_h > 0) {
-                cam = *cptr;
-                have_cam = true;
+            const AmeCamera* cptr = &cams[cam_self ? i : 0];
+            if (cptr->viewport_w > 0 && cptr->viewport_h > 0) {
+                snap.cam = *cptr;
+                snap.have_cam = true;
                 break;
             }
         }
-        if (have_cam) {
+        if (snap.have_cam) {
             // We are breaking out early; finalize iterator to avoid leaks
             ecs_iter_fini(&cam_iter);
             break;
         }
     }
-    ecs_query_fini(cam_query);
-    
-    if (!have_cam) {
-        SDL_Log("[RP] frame=%d no camera found; nothing rendered", g_rp_frame);
-        g_rp_frame++;
-        return;
-    }
-    
-    // Setup viewport and projection matrix
-    glViewport(0, 0, cam.viewport_w, cam.viewport_h);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    
-    // Use target position as center (bottom-left coordinate system)
-    float half_w = cam.viewport_w / (2.0f * cam.zoom);
-    float half_h = cam.viewport_h / (2.0f * cam.zoom);
-    
-    // Center camera on target position
-    glm::mat4 projection = glm::ortho(cam.target_x - half_w, cam.target_x + half_w, 
-                                       cam.target_y - half_h, cam.target_y + half_h, 
-                                       -100.0f, 100.0f);
-    
-    // Only render tilemaps if any exist
-    ecs_query_desc_t tilemap_check_desc = {};
-    tilemap_check_desc.terms[0].id = g_comp.tilemap;
-    ecs_query_t* tilemap_check_query = ecs_query_init(w, &tilemap_check_desc);
-    ecs_iter_t tilemap_check_iter = ecs_query_iter(w, tilemap_check_query);
-    bool has_tilemaps = ecs_query_next(&tilemap_check_iter);
-    if (has_tilemaps) {
-        ecs_iter_fini(&tilemap_check_iter); // Finalize early exit
-    }
-    ecs_query_fini(tilemap_check_query);
-    
-    if (has_tilemaps) {
-        // Render tilemaps first (background) via shared compositor in one pass
-        // Use target position for consistent camera positioning
-        render_tilemap_layers_batch(w, cam.target_x, cam.target_y, cam.zoom, cam.viewport_w, cam.viewport_h, &dc_draw_calls);
+    if (!snap.have_cam) return;
+
+    // Only gather tilemaps if any exist
+    if (ecs_query_is_true(queries.tilemap)) {
+        gather_tile_layers(w, queries.tilemap, snap.tile_layers);
     }
-    
-    // Ensure pixelation target exists (we will only pixelate mesh pass)
-    ensure_pixel_target(cam.viewport_w, cam.viewport_h);
 
-    // Collect and batch sprites (to render at full resolution later)
-    std::vector<SpriteBatch> batches;
-    std::map<GLuint, SpriteBatch*> batch_map;
-    
-    // Query for sprites with transform
-    ecs_query_desc_t sprite_query_desc = {};
-    sprite_query_desc.terms[0].id = g_comp.sprite;
-    sprite_query_desc.terms[1].id = g_comp.transform;
-    ecs_query_t* sprite_query = ecs_query_init(w, &sprite_query_desc);
-    ecs_iter_t sprite_iter = ecs_query_iter(w, sprite_query);
-    
-    struct SpriteInfo {
-        AmeTransform2D transform;
-        SpriteData sprite;
-        ecs_entity_t entity;
-    };
-    std::vector<SpriteInfo> sprites;
-    
+    // Sprites with transform, read straight from the table columns. The extracting thread walks
+    // the matched tables; the per-row copy runs on the shared job pool for large scenes.
+    static thread_local std::vector<SpriteChunk> chunks; // reused across frames
+    static thread_local std::vector<SpriteInfo> sprites;
+    ame_profiler_begin("rp.sprite_gather");
+    chunks.clear();
+    size_t sprite_rows = 0;
+    ecs_iter_t sprite_iter = ecs_query_iter(w, queries.sprite);
     while (ecs_query_next(&sprite_iter)) {
-        for (int i = 0; i < sprite_iter.count; ++i) {
-            SpriteData* sprite = (SpriteData*)ecs_get_id(w, sprite_iter.entities[i], g_comp.sprite);
-            AmeTransform2D* transform = (AmeTransform2D*)ecs_get_id(w, sprite_iter.entities[i], g_comp.transform);
-            
-            if (sprite && transform && sprite->visible) {
-// Compose world transform using helper
-                AmeWorldTransform2D wtf = ameComputeWorldTransform(w, sprite_iter.entities[i]);
-                AmeTransform2D wt = { wtf.x, wtf.y, wtf.angle }; 
-                sprites.push_back({wt, *sprite, sprite_iter.entities[i]});
-                dc_sprites_seen++;
-            } else {
-                if (!sprite) {
-                    dc_missing_sprite++;
-                    if (dc_missing_sprite <= kMaxMissingLogs) {
-                        SDL_Log("[RP] missing SpriteData on entity=%llu", (unsigned long long)sprite_iter.entities[i]);
-                    }
-                }
-                if (!transform) {
-                    dc_missing_transform++;
-                    if (dc_missing_transform <= kMaxMissingLogs) {
-                        SDL_Log("[RP] missing Transform on entity=%llu", (unsigned long long)sprite_iter.entities[i]);
-                    }
-                }
-            }
-        }
+        SpriteChunk c;
+        c.sp = ecs_field(&sprite_iter, SpriteData, 0);
+        c.tr = ecs_field(&sprite_iter, AmeTransform2D, 1);
+        c.sp_self = ecs_field_is_self(&sprite_iter, 0);
+        c.tr_self = ecs_field_is_self(&sprite_iter, 1);
+        c.cached = ecs_field_is_set(&sprite_iter, 2) ? ecs_field(&sprite_iter, AmeWorldTransform2D, 2) : nullptr;
+        c.parented = !c.cached && table_has_parent(w, sprite_iter.table);
+        c.entities = sprite_iter.entities;
+        c.count = sprite_iter.count;
+        c.offset = sprite_rows;
+        sprite_rows += (size_t)c.count;
+        chunks.push_back(c);
     }
-    // No early break occurred; iterator has already been finalized by Flecs when exhausted
-    ecs_query_fini(sprite_query);
-    
+    sprites.resize(sprite_rows);
+    SpriteExtract extract{ w, chunks.data(), sprites.data() };
+    ame_jobs_parallel_for(sprite_rows >= kParallelSpriteRows ? ame_jobs_shared() : nullptr,
+                          chunks.size(), extract_sprite_chunk, &extract);
+    // Parented rows without a cached transform walk the hierarchy; keep those on this thread
+    for (SpriteChunk& c : chunks) {
+        if (c.parented) extract_chunk(w, c, sprites.data(), true);
+    }
+    // Compact the visible rows of each chunk to the front
+    size_t visible = 0;
+    for (const SpriteChunk& c : chunks) {
+        if (visible != c.offset && c.kept)
+            std::memmove(&sprites[visible], &sprites[c.offset], c.kept * sizeof(SpriteInfo));
+        visible += c.kept;
+    }
+    sprites.resize(visible);
+    snap.sprites_seen = (int)visible;
+    ame_profiler_end();
+
     // Sort sprites by layer, then by z, then by texture
+    ame_profiler_begin("rp.sprite_batch");
     std::sort(sprites.begin(), sprites.end(), [](const SpriteInfo& a, const SpriteInfo& b) {
         if (a.sprite.sorting_layer != b.sprite.sorting_layer)
             return a.sprite.sorting_layer < b.sprite.sorting_layer;
@@ -635,74 +737,196 @@ void ame_rp_run_ecs(ecs_world_t* w) {
             return a.sprite.order_in_layer < b.sprite.order_in_layer;
         return a.sprite.tex < b.sprite.tex;
     });
-    
-    // Batch sprites by texture
+
+    // Batch sprites by texture (texture 0 keeps its own batches and draws with the white fallback)
+    static thread_local std::unordered_map<GLuint, size_t> batch_map; // texture -> index of its open batch
+    batch_map.clear();
     for (const auto& info : sprites) {
         SpriteBatch* batch = nullptr;
-        
-        // Use white texture as fallback if sprite has no texture
         GLuint texture_id = info.sprite.tex;
-        if (texture_id == 0) {
-            texture_id = g_white_texture;
-        }
-        
+
         // Find or create batch for this texture
         auto it = batch_map.find(texture_id);
-        if (it == batch_map.end() || 
-            it->second->layer != info.sprite.sorting_layer ||
-            std::abs(it->second->z - info.sprite.z) > 0.001f) {
-            batches.emplace_back();
-            batch = &batches.back();
-            dc_batches++;
+        if (it == batch_map.end() ||
+            snap.batches[it->second].layer != info.sprite.sorting_layer ||
+            std::abs(snap.batches[it->second].z - info.sprite.z) > 0.001f) {
+            if (snap.batch_count == snap.batches.size()) snap.batches.emplace_back();
+            batch = &snap.batches[snap.batch_count];
+            batch->vertices.clear();
             batch->texture = texture_id;
             batch->layer = info.sprite.sorting_layer;
             batch->z = info.sprite.z;
-            batch_map[texture_id] = batch;
+            batch_map[texture_id] = snap.batch_count++;
         } else {
-            batch = it->second;
+            batch = &snap.batches[it->second];
         }
-        
+
         // Add sprite vertices to batch (two triangles)
         float hw = info.sprite.w * 0.5f;
         float hh = info.sprite.h * 0.5f;
         float x = info.transform.x;
         float y = info.transform.y;
-        
+
         // Apply rotation if needed
         float cos_r = cosf(info.transform.angle);
         float sin_r = sinf(info.transform.angle);
-        
+
         auto rotate = [cos_r, sin_r, x, y](float px, float py) -> std::pair<float, float> {
             float dx = px - x;
             float dy = py - y;
             return {x + dx * cos_r - dy * sin_r, y + dx * sin_r + dy * cos_r};
         };
-        
+
         auto [x0, y0] = rotate(x - hw, y - hh);
         auto [x1, y1] = rotate(x + hw, y - hh);
         auto [x2, y2] = rotate(x + hw, y + hh);
         auto [x3, y3] = rotate(x - hw, y + hh);
-        
+
         // First triangle
         float z = info.sprite.z;
-        batch->vertices.push_back({x0, y0, z, info.sprite.u0, info.sprite.v1, 
+        batch->vertices.push_back({x0, y0, z, info.sprite.u0, info.sprite.v1,
                                    info.sprite.r, info.sprite.g, info.sprite.b, info.sprite.a});
-        batch->vertices.push_back({x1, y1, z, info.sprite.u1, info.sprite.v1, 
+        batch->vertices.push_back({x1, y1, z, info.sprite.u1, info.sprite.v1,
                                    info.sprite.r, info.sprite.g, info.sprite.b, info.sprite.a});
-        batch->vertices.push_back({x2, y2, z, info.sprite.u1, info.sprite.v0, 
+        batch->vertices.push_back({x2, y2, z, info.sprite.u1, info.sprite.v0,
                                    info.sprite.r, info.sprite.g, info.sprite.b, info.sprite.a});
-        
+
         // Second triangle
-        batch->vertices.push_back({x0, y0, z, info.sprite.u0, info.sprite.v1, 
+        batch->vertices.push_back({x0, y0, z, info.sprite.u0, info.sprite.v1,
                                    info.sprite.r, info.sprite.g, info.sprite.b, info.sprite.a});
-        batch->vertices.push_back({x2, y2, z, info.sprite.u1, info.sprite.v0, 
+        batch->vertices.push_back({x2, y2, z, info.sprite.u1, info.sprite.v0,
                                    info.sprite.r, info.sprite.g, info.sprite.b, info.sprite.a});
-        batch->vertices.push_back({x3, y3, z, info.sprite.u0, info.sprite.v0, 
+        batch->vertices.push_back({x3, y3, z, info.sprite.u0, info.sprite.v0,
                                    info.sprite.r, info.sprite.g, info.sprite.b, info.sprite.a});
     }
-    
+    ame_profiler_end();
+
+    // Meshes: resolve texture, tint and parallax, and copy the vertices interleaved (pos, uv, col)
+    ame_profiler_begin("rp.mesh_extract");
+    ecs_iter_t mit = ecs_query_iter(w, queries.mesh);
+    while (ecs_query_next(&mit)) {
+        const MeshData* meshes = ecs_field(&mit, MeshData, 0);
+        const SpriteData* sprites_col = ecs_field_is_set(&mit, 2) ? ecs_field(&mit, SpriteData, 2) : nullptr;
+        const MaterialData* mtl_col = ecs_field_is_set(&mit, 3) ? ecs_field(&mit, MaterialData, 3) : nullptr;
+        bool mesh_self = ecs_field_is_self(&mit, 0);
+        bool sd_self = ecs_field_is_self(&mit, 2);
+        bool mtl_self = ecs_field_is_self(&mit, 3);
+        for (int i = 0; i < mit.count; ++i) {
+            const MeshData* mr = &meshes[mesh_self ? i : 0];
+            if (mr->count == 0 || !mr->pos) continue;
+
+            GLuint texture_id = 0;
+            const SpriteData* sdata = sprites_col ? &sprites_col[sd_self ? i : 0] : nullptr;
+            const MaterialData* mtl = mtl_col ? &mtl_col[mtl_self ? i : 0] : nullptr;
+            float cr=1, cg=1, cb=1, ca=1;
+            if (mtl) { if (mtl->tex) texture_id = mtl->tex; cr *= mtl->r; cg *= mtl->g; cb *= mtl->b; ca *= mtl->a; }
+            if (sdata) { if (sdata->tex) texture_id = sdata->tex; cr*=sdata->r; cg*=sdata->g; cb*=sdata->b; ca*=sdata->a; }
+            // Determine parallax factor (1=no parallax). Prefer name prefix Parallax_x.xx, otherwise derive from sprite.z if present.
+            float parallax = 1.0f;
+            const char* name = ecs_get_name(w, mit.entities[i]);
+            if (name && strncmp(name, "Parallax_", 9) == 0) {
+                parallax = (float)atof(name + 9);
+                if (parallax < 0.0f) parallax = 0.0f;
+                if (parallax > 1.0f) parallax = 1.0f;
+            } else if (sdata) {
+                // Map z in [-10..10] to [0..1] where negative pushes to background
+                float z = sdata->z;
+                if (z < 0.0f) {
+                    parallax = 1.0f / (1.0f + (-z)); // z=-1 => 0.5, z=-3 => 0.25
+                } else {
+                    parallax = 1.0f; // foreground same speed
+                }
+            }
+
+            size_t vc = mr->count;
+            size_t first = snap.mesh_vertices.size() / 8;
+            snap.mesh_vertices.reserve(snap.mesh_vertices.size() + vc * 8);
+            const float* pos = mr->pos; const float* uv = mr->uv;
+            for (size_t v = 0; v < vc; ++v) {
+                float u = uv ? uv[v*2+0] : 0.0f; float vv = uv ? uv[v*2+1] : 0.0f;
+                float vert[8] = { pos[v*2+0], pos[v*2+1], u, vv, cr, cg, cb, ca };
+                snap.mesh_vertices.insert(snap.mesh_vertices.end(), vert, vert + 8);
+            }
+            snap.meshes.push_back({ texture_id, parallax, first, vc });
+        }
+    }
+    ame_profiler_end();
+
+    // Text: strings are copied so the snapshot stays valid while the logic thread edits them
+    ecs_iter_t tit = ecs_query_iter(w, queries.text);
+    while (ecs_query_next(&tit)) {
+        const TextData* texts = ecs_field(&tit, TextData, 0);
+        const AmeTransform2D* tr = ecs_field_is_set(&tit, 1) ? ecs_field(&tit, AmeTransform2D, 1) : nullptr;
+        const AmeWorldTransform2D* wt = ecs_field_is_set(&tit, 2) ? ecs_field(&tit, AmeWorldTransform2D, 2) : nullptr;
+        bool text_self = ecs_field_is_self(&tit, 0);
+        bool tr_self = ecs_field_is_self(&tit, 1);
+        for (int i = 0; i < tit.count; ++i) {
+            const TextData& t = texts[text_self ? i : 0];
+            if (!t.text_ptr) continue;
+            AmeRenderText rt = {};
+            if (wt) { rt.x = wt[i].x; rt.y = wt[i].y; }
+            else if (tr) { rt.x = tr[tr_self ? i : 0].x; rt.y = tr[tr_self ? i : 0].y; }
+            rt.font = t.font;
+            rt.r = t.r; rt.g = t.g; rt.b = t.b; rt.a = t.a;
+            rt.size = t.size;
+            rt.wrap_px = t.wrap_px;
+            // Offset for now; turned into a pointer once text_chars stops growing
+            rt.text = reinterpret_cast<const char*>(snap.text_chars.size());
+            size_t len = std::strlen(t.text_ptr);
+            snap.text_chars.insert(snap.text_chars.end(), t.text_ptr, t.text_ptr + len + 1);
+            snap.texts.push_back(rt);
+        }
+    }
+    for (AmeRenderText& rt : snap.texts) {
+        rt.text = snap.text_chars.data() + reinterpret_cast<size_t>(rt.text);
+    }
+}
+
+// Draw a snapshot with GL; render thread only
+void draw_snapshot(const AmeRenderSnapshot& snap) {
+    AmeProfileScope prof_frame("rp.frame");
+    init_shaders();
+    init_fallback_textures();
+    init_white_texture();
+
+    // Per-frame counters
+    int dc_draw_calls = 0;
+    int dc_tilemaps = 0;
+
+    if (!snap.have_cam) {
+        SDL_Log("[RP] frame=%d no camera found; nothing rendered", g_rp_frame);
+        g_rp_frame++;
+        return;
+    }
+    const AmeCamera& cam = snap.cam;
+
+    // Setup viewport and projection matrix
+    glViewport(0, 0, cam.viewport_w, cam.viewport_h);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    // Use target position as center (bottom-left coordinate system)
+    float half_w = cam.viewport_w / (2.0f * cam.zoom);
+    float half_h = cam.viewport_h / (2.0f * cam.zoom);
+
+    // Center camera on target position
+    glm::mat4 projection = glm::ortho(cam.target_x - half_w, cam.target_x + half_w,
+                                       cam.target_y - half_h, cam.target_y + half_h,
+                                       -100.0f, 100.0f);
+
+    // Render tilemaps first (background) via shared compositor in one pass
+    // Use target position for consistent camera positioning
+    if (!snap.tile_layers.empty()) {
+        AmeProfileScope prof("rp.tilemaps");
+        render_tilemap_layers_batch(snap.tile_layers, cam.target_x, cam.target_y, cam.zoom, cam.viewport_w, cam.viewport_h, &dc_draw_calls);
+    }
+
+    // Ensure pixelation target exists (we will only pixelate mesh pass)
+    ensure_pixel_target(cam.viewport_w, cam.viewport_h);
+
     // Mesh rendering pass: render MeshData to offscreen target at higher resolution
     // We will pixelate this pass only and then draw it as background to the default framebuffer
+    ame_profiler_begin("rp.mesh_pass");
     ensure_mesh_target(cam.viewport_w, cam.viewport_h);
     if (g_mesh_fbo && g_mesh_color_tex && g_mesh_target_w > 0 && g_mesh_target_h > 0) {
         glBindFramebuffer(GL_FRAMEBUFFER, g_mesh_fbo);
@@ -715,70 +939,23 @@ void ame_rp_run_ecs(ecs_world_t* w) {
         glUniformMatrix4fv(g_mesh_mvp_loc, 1, GL_FALSE, glm::value_ptr(projection));
         glUniform2f(g_mesh_cam_loc, cam.target_x, cam.target_y);
 
-        ecs_query_desc_t mesh_qd = {};
-        mesh_qd.terms[0].id = g_comp.mesh;
-        mesh_qd.terms[1].id = g_comp.transform;
-        ecs_query_t* mesh_q = ecs_query_init(w, &mesh_qd);
-        ecs_iter_t mit = ecs_query_iter(w, mesh_q);
-        while (ecs_query_next(&mit)) {
-            for (int i = 0; i < mit.count; ++i) {
-                MeshData* mr = (MeshData*)ecs_get_id(w, mit.entities[i], g_comp.mesh);
-                AmeTransform2D* tr = (AmeTransform2D*)ecs_get_id(w, mit.entities[i], g_comp.transform);
-                if (!mr || !tr || mr->count == 0 || !mr->pos) continue;
-// Compose world transform
-                AmeWorldTransform2D wtf = ameComputeWorldTransform(w, mit.entities[i]);
-                float wx = wtf.x, wy = wtf.y, wa = wtf.angle;
-
-                GLuint texture_id = g_white_texture;
-                SpriteData* sdata = (SpriteData*)ecs_get_id(w, mit.entities[i], g_comp.sprite);
-                MaterialData* mtl = (MaterialData*)ecs_get_id(w, mit.entities[i], g_comp.material);
-                float cr=1, cg=1, cb=1, ca=1;
-                if (mtl) { if (mtl->tex) texture_id = mtl->tex; cr *= mtl->r; cg *= mtl->g; cb *= mtl->b; ca *= mtl->a; }
-                if (sdata) { if (sdata->tex) texture_id = sdata->tex; cr*=sdata->r; cg*=sdata->g; cb*=sdata->b; ca*=sdata->a; }
-                // Determine parallax factor (1=no parallax). Prefer name prefix Parallax_x.xx, otherwise derive from sprite.z if present.
-                float parallax = 1.0f;
-                const char* name = ecs_get_name(w, mit.entities[i]);
-                if (name && strncmp(name, "Parallax_", 9) == 0) {
-                    parallax = (float)atof(name + 9);
-                    if (parallax < 0.0f) parallax = 0.0f; if (parallax > 1.0f) parallax = 1.0f;
-                } else if (sdata) {
-                    // Map z in [-10..10] to [0..1] where negative pushes to background
-                    float z = sdata->z;
-                    if (z < 0.0f) {
-                        parallax = 1.0f / (1.0f + (-z)); // z=-1 => 0.5, z=-3 => 0.25
-                    } else {
-                        parallax = 1.0f; // foreground same speed
-                    }
-                }
-                glUniform1f(g_mesh_parallax_loc, parallax);
-
-                // Build interleaved buffer: pos(2), uv(2), col(4)
-                size_t vc = mr->count;
-                std::vector<float> buf; buf.reserve(vc * 8);
-                const float* pos = mr->pos; const float* uv = mr->uv;
-                for (size_t v = 0; v < vc; ++v) {
-                    float px = pos[v*2+0]; float py = pos[v*2+1];
-                    float u = uv ? uv[v*2+0] : 0.0f; float vv = uv ? uv[v*2+1] : 0.0f;
-                    buf.push_back(px); buf.push_back(py);
-                    buf.push_back(u); buf.push_back(vv);
-                    buf.push_back(cr); buf.push_back(cg); buf.push_back(cb); buf.push_back(ca);
-                }
-                GLuint vao=0, vbo=0; glGenVertexArrays(1,&vao); glBindVertexArray(vao);
-                glGenBuffers(1,&vbo); glBindBuffer(GL_ARRAY_BUFFER, vbo);
-                glBufferData(GL_ARRAY_BUFFER, buf.size()*sizeof(float), buf.data(), GL_DYNAMIC_DRAW);
-                glEnableVertexAttribArray(0); glVertexAttribPointer(0,2,GL_FLOAT,GL_FALSE, sizeof(float)*8, (void*)0);
-                glEnableVertexAttribArray(1); glVertexAttribPointer(1,2,GL_FLOAT,GL_FALSE, sizeof(float)*8, (void*)(sizeof(float)*2));
-                glEnableVertexAttribArray(2); glVertexAttribPointer(2,4,GL_FLOAT,GL_FALSE, sizeof(float)*8, (void*)(sizeof(float)*4));
-
-                glActiveTexture(GL_TEXTURE0); glBindTexture(GL_TEXTURE_2D, texture_id);
-                glUniform1i(g_mesh_tex_loc, 0);
-                glDrawArrays(GL_TRIANGLES, 0, (GLsizei)vc);
-                dc_draw_calls++;
-                glBindBuffer(GL_ARRAY_BUFFER, 0); glBindVertexArray(0);
-                glDeleteBuffers(1,&vbo); glDeleteVertexArrays(1,&vao);
-            }
+        for (const AmeRenderSnapshot::MeshDraw& m : snap.meshes) {
+            glUniform1f(g_mesh_parallax_loc, m.parallax);
+            const float* buf = snap.mesh_vertices.data() + m.first * 8;
+            GLuint vao=0, vbo=0; glGenVertexArrays(1,&vao); glBindVertexArray(vao);
+            glGenBuffers(1,&vbo); glBindBuffer(GL_ARRAY_BUFFER, vbo);
+            glBufferData(GL_ARRAY_BUFFER, m.count*8*sizeof(float), buf, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(0); glVertexAttribPointer(0,2,GL_FLOAT,GL_FALSE, sizeof(float)*8, (void*)0);
+            glEnableVertexAttribArray(1); glVertexAttribPointer(1,2,GL_FLOAT,GL_FALSE, sizeof(float)*8, (void*)(sizeof(float)*2));
+            glEnableVertexAttribArray(2); glVertexAttribPointer(2,4,GL_FLOAT,GL_FALSE, sizeof(float)*8, (void*)(sizeof(float)*4));
+
+            glActiveTexture(GL_TEXTURE0); glBindTexture(GL_TEXTURE_2D, m.texture ? m.texture : g_white_texture);
+            glUniform1i(g_mesh_tex_loc, 0);
+            glDrawArrays(GL_TRIANGLES, 0, (GLsizei)m.count);
+            dc_draw_calls++;
+            glBindBuffer(GL_ARRAY_BUFFER, 0); glBindVertexArray(0);
+            glDeleteBuffers(1,&vbo); glDeleteVertexArrays(1,&vao);
         }
-        ecs_query_fini(mesh_q);
 
         // Pixelate the mesh pass by downsampling to low-res target
         // Use mipmapped linear filtering to approximate a box-filter resolve (SSAA-like)
@@ -816,19 +993,81 @@ void ame_rp_run_ecs(ecs_world_t* w) {
         glBindVertexArray(0);
     }
 
+    ame_profiler_end();
+
     // Now render sprite batches at full resolution on top (non-pixelated)
+    ame_profiler_begin("rp.sprite_draw");
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
     glViewport(0, 0, cam.viewport_w, cam.viewport_h);
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    for (const auto& batch : batches) {
-        render_sprite_batch(batch, projection, &dc_draw_calls);
+    for (size_t b = 0; b < snap.batch_count; ++b) {
+        render_sprite_batch(snap.batches[b], snap.batches[b].texture ? snap.batches[b].texture : g_white_texture,
+                            projection, &dc_draw_calls);
     }
 
     glDisable(GL_BLEND);
+    ame_profiler_end();
 
-    SDL_Log("[RP] frame=%d cam(x=%.2f y=%.2f zoom=%.2f vp=%dx%d) tilemaps=%d sprites_seen=%d batches=%d draw_calls=%d missing{sprite=%d,transform=%d}",
+    SDL_Log("[RP] frame=%d cam(x=%.2f y=%.2f zoom=%.2f vp=%dx%d) tilemaps=%d sprites_seen=%d batches=%d draw_calls=%d",
             g_rp_frame, cam.x, cam.y, cam.zoom, cam.viewport_w, cam.viewport_h,
-            dc_tilemaps, dc_sprites_seen, dc_batches, dc_draw_calls, dc_missing_sprite, dc_missing_transform);
+            dc_tilemaps, snap.sprites_seen, (int)snap.batch_count, dc_draw_calls);
     g_rp_frame++;
 }
+
+} // namespace
+
+// Triple buffer: the extractor fills `back`, the renderer draws `front`, and `ready` holds the
+// newest complete snapshot (kFresh set until the renderer takes it). Both sides only swap
+// indices, so neither ever waits for the other.
+struct AmeRenderExchange {
+    static constexpr uint32_t kFresh = 4u;
+    AmeRenderSnapshot slots[3];
+    std::atomic<uint32_t> ready{2u};
+    uint32_t back = 0;   // extractor thread only
+    uint64_t ticks = 0;  // extractor thread only; one count for all slots
+    uint32_t front = 1;  // render thread only
+};
+
+void ame_rp_run_ecs(ecs_world_t* w) {
+    if (!w) return;
+    static AmeRenderSnapshot snap; // single-thread path: extract and draw back to back
+    extract_snapshot(w, snap, snap.tick + 1);
+    draw_snapshot(snap);
+}
+
+AmeRenderExchange* ame_rp_exchange_create(void) {
+    return new AmeRenderExchange();
+}
+
+void ame_rp_exchange_destroy(AmeRenderExchange* x) {
+    delete x;
+}
+
+void ame_rp_extract(ecs_world_t* w, AmeRenderExchange* x) {
+    if (!w || !x) return;
+    extract_snapshot(w, x->slots[x->back], ++x->ticks);
+    x->back = x->ready.exchange(x->back | AmeRenderExchange::kFresh, std::memory_order_acq_rel) & 3u;
+}
+
+const AmeRenderSnapshot* ame_rp_acquire_latest(AmeRenderExchange* x) {
+    if (!x) return nullptr;
+    if (x->ready.load(std::memory_order_relaxed) & AmeRenderExchange::kFresh) {
+        x->front = x->ready.exchange(x->front, std::memory_order_acq_rel) & 3u;
+    }
+    const AmeRenderSnapshot* s = &x->slots[x->front];
+    return s->tick ? s : nullptr;
+}
+
+void ame_rp_draw_snapshot(const AmeRenderSnapshot* s) {
+    if (s) draw_snapshot(*s);
+}
+
+uint64_t ame_rp_snapshot_tick(const AmeRenderSnapshot* s) {
+    return s ? s->tick : 0;
+}
+
+size_t ame_rp_snapshot_texts(const AmeRenderSnapshot* s, const AmeRenderText** out) {
+    if (out) *out = s && !s->texts.empty() ? s->texts.data() : nullptr;
+    return s ? s->texts.size() : 0;
+}
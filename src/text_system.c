@@ -1,31 +1,243 @@
+#include "ame/text_system.h"
 #include <stdlib.h>
 #include <string.h>
 
 #if AME_WITH_FLECS
 #include <flecs.h>
+#include <pthread.h>
+#include <stdint.h>
 
 // Mirror of façade TextData POD
 typedef struct Text {
-    const char* text_ptr; // owned by engine (heap)
+    const char* text_ptr; // owned by the world's text arena
     unsigned int font;
     float r,g,b,a;
     float size;
     int wrap_px;
-    int request_set;
-    char request_buf[256];
 } Text;
 
+// Strings live in size-classed slots (16..1024 bytes including an 8-byte header) carved from
+// 64 KiB blocks; longer ones fall back to malloc. Released slots go to a per-class free list,
+// so text that changes every frame reuses the same few slots.
+enum { kSlotClasses = 7, kMinSlot = 16, kBlockSize = 64 * 1024 };
+#define TEXT_HEAP_SLOT 0xffffffffu
+
+typedef struct SlotHeader { uint32_t cls; uint32_t pad; } SlotHeader;
+
+typedef struct PendingText {
+    ecs_entity_t entity;
+    size_t offset, len; // into TextArena.chars
+} PendingText;
+
+typedef struct TextArena {
+    const ecs_world_t* world;
+    struct TextArena* next;
+    ecs_entity_t text_id;
+    // Pending requests; guarded by mtx
+    pthread_mutex_t mtx;
+    PendingText* pending;
+    size_t pending_count, pending_cap;
+    char* chars;
+    size_t chars_size, chars_cap;
+    // String slots; world thread only
+    SlotHeader* free_slots[kSlotClasses];
+    unsigned char** blocks;
+    size_t block_count, block_cap;
+    size_t block_used; // bytes carved from the newest block
+} TextArena;
+
+static pthread_mutex_t g_arenas_mtx = PTHREAD_MUTEX_INITIALIZER;
+static TextArena* g_arenas;
+
+static void arena_fini(ecs_world_t* w, void* ctx) {
+    (void)w;
+    TextArena* a = (TextArena*)ctx;
+    pthread_mutex_lock(&g_arenas_mtx);
+    for (TextArena** p = &g_arenas; *p; p = &(*p)->next) {
+        if (*p == a) { *p = a->next; break; }
+    }
+    pthread_mutex_unlock(&g_arenas_mtx);
+    // Heap-sized strings still referenced by Text components are not tracked; the world is gone
+    for (size_t i = 0; i < a->block_count; ++i) free(a->blocks[i]);
+    free(a->blocks);
+    free(a->pending);
+    free(a->chars);
+    pthread_mutex_destroy(&a->mtx);
+    free(a);
+}
+
+// Arenas are created by ame_text_system_register and die with their world
+static TextArena* arena_for(const ecs_world_t* w) {
+    if (!w) return NULL;
+    const ecs_world_t* real = ecs_get_world(w);
+    pthread_mutex_lock(&g_arenas_mtx);
+    TextArena* a = g_arenas;
+    while (a && a->world != real) a = a->next;
+    pthread_mutex_unlock(&g_arenas_mtx);
+    return a;
+}
+
+static TextArena* arena_create(ecs_world_t* w) {
+    TextArena* a = arena_for(w);
+    if (a) return a;
+    a = (TextArena*)calloc(1, sizeof *a);
+    if (!a) return NULL;
+    a->world = w;
+    pthread_mutex_init(&a->mtx, NULL);
+    pthread_mutex_lock(&g_arenas_mtx);
+    a->next = g_arenas;
+    g_arenas = a;
+    pthread_mutex_unlock(&g_arenas_mtx);
+    ecs_atfini(w, arena_fini, a);
+    return a;
+}
+
+static char* slot_alloc(TextArena* a, size_t len) {
+    size_t need = sizeof(SlotHeader) + len + 1;
+    uint32_t cls = 0;
+    while (cls < kSlotClasses && ((size_t)kMinSlot << cls) < need) cls++;
+    SlotHeader* h;
+    if (cls == kSlotClasses) {
+        h = (SlotHeader*)malloc(need);
+        if (!h) return NULL;
+        h->cls = TEXT_HEAP_SLOT;
+        return (char*)(h + 1);
+    }
+    size_t slot = (size_t)kMinSlot << cls;
+    if (a->free_slots[cls]) {
+        h = a->free_slots[cls];
+        memcpy(&a->free_slots[cls], h, sizeof(SlotHeader*));
+    } else {
+        if (a->block_count == 0 || a->block_used + slot > kBlockSize) {
+            if (a->block_count == a->block_cap) {
+                size_t cap = a->block_cap ? a->block_cap * 2 : 8;
+                unsigned char** b = (unsigned char**)realloc(a->blocks, cap * sizeof *b);
+                if (!b) return NULL;
+                a->blocks = b;
+                a->block_cap = cap;
+            }
+            unsigned char* block = (unsigned char*)malloc(kBlockSize);
+            if (!block) return NULL;
+            a->blocks[a->block_count++] = block;
+            a->block_used = 0;
+        }
+        h = (SlotHeader*)(a->blocks[a->block_count - 1] + a->block_used);
+        a->block_used += slot;
+    }
+    h->cls = cls;
+    return (char*)(h + 1);
+}
+
+static void slot_release(TextArena* a, const char* s) {
+    if (!s) return;
+    SlotHeader* h = (SlotHeader*)s - 1;
+    if (h->cls == TEXT_HEAP_SLOT) { free(h); return; }
+    uint32_t cls = h->cls;
+    // The free-list link overwrites the header of the released slot
+    memcpy(h, &a->free_slots[cls], sizeof(SlotHeader*));
+    a->free_slots[cls] = h;
+}
+
+const char* ame_text_store(ecs_world_t* w, const char* s, size_t len) {
+    TextArena* a = arena_for(w);
+    if (!a || (!s && len)) return NULL;
+    char* out = slot_alloc(a, len);
+    if (!out) return NULL;
+    if (len) memcpy(out, s, len);
+    out[len] = '\0';
+    return out;
+}
+
+void ame_text_release(ecs_world_t* w, const char* s) {
+    TextArena* a = arena_for(w);
+    if (a) slot_release(a, s);
+}
+
+bool ame_text_request(ecs_world_t* w, ecs_entity_t e, const char* s, size_t len) {
+    TextArena* a = arena_for(w);
+    if (!a || !e || (!s && len)) return false;
+    bool ok = false;
+    pthread_mutex_lock(&a->mtx);
+    if (a->pending_count == a->pending_cap) {
+        size_t cap = a->pending_cap ? a->pending_cap * 2 : 64;
+        PendingText* p = (PendingText*)realloc(a->pending, cap * sizeof *p);
+        if (!p) goto done;
+        a->pending = p;
+        a->pending_cap = cap;
+    }
+    if (a->chars_size + len > a->chars_cap) {
+        size_t cap = a->chars_cap ? a->chars_cap : 4096;
+        while (cap < a->chars_size + len) cap *= 2;
+        char* c = (char*)realloc(a->chars, cap);
+        if (!c) goto done;
+        a->chars = c;
+        a->chars_cap = cap;
+    }
+    if (len) memcpy(a->chars + a->chars_size, s, len);
+    a->pending[a->pending_count++] = (PendingText){ e, a->chars_size, len };
+    a->chars_size += len;
+    ok = true;
+done:
+    pthread_mutex_unlock(&a->mtx);
+    return ok;
+}
+
+size_t ame_text_apply_requests(ecs_world_t* w) {
+    TextArena* a = arena_for(w);
+    if (!a) return 0;
+    // Take the queue so observers reacting to the new text may request again
+    pthread_mutex_lock(&a->mtx);
+    PendingText* pending = a->pending;
+    size_t count = a->pending_count;
+    char* chars = a->chars;
+    size_t pending_cap = a->pending_cap, chars_cap = a->chars_cap;
+    a->pending = NULL; a->pending_count = 0; a->pending_cap = 0;
+    a->chars = NULL; a->chars_size = 0; a->chars_cap = 0;
+    pthread_mutex_unlock(&a->mtx);
+
+    size_t applied = 0;
+    for (size_t i = 0; a->text_id && i < count; ++i) {
+        const PendingText* r = &pending[i];
+        if (!ecs_is_alive(w, r->entity)) continue;
+        Text* t = (Text*)ecs_get_mut_id(w, r->entity, a->text_id);
+        if (!t) continue; // Text removed since the request
+        // Release first so a same-sized replacement takes the slot it frees
+        slot_release(a, t->text_ptr);
+        char* s = slot_alloc(a, r->len);
+        t->text_ptr = s;
+        if (s) {
+            if (r->len) memcpy(s, chars + r->offset, r->len);
+            s[r->len] = '\0';
+        }
+        ecs_modified_id(w, r->entity, a->text_id);
+        if (s) applied++;
+    }
+
+    // Hand the buffers back unless a new queue was started meanwhile
+    pthread_mutex_lock(&a->mtx);
+    if (!a->pending && !a->chars) {
+        a->pending = pending; a->pending_cap = pending_cap;
+        a->chars = chars; a->chars_cap = chars_cap;
+        pending = NULL; chars = NULL;
+    }
+    pthread_mutex_unlock(&a->mtx);
+    free(pending);
+    free(chars);
+    return applied;
+}
+
 static void SysTextApplyRequests(ecs_iter_t* it) {
+    ame_text_apply_requests(it->world);
+}
+
+// Strings go back to the arena when the Text component (or its entity) goes away
+static void SysTextRelease(ecs_iter_t* it) {
+    TextArena* a = arena_for(it->real_world);
+    if (!a) return;
     Text* t = ecs_field(it, Text, 0);
     for (int i = 0; i < it->count; ++i) {
-        if (t[i].request_set) {
-            if (t[i].text_ptr) { free((void*)t[i].text_ptr); }
-            size_t n = strnlen(t[i].request_buf, sizeof t[i].request_buf);
-            char* heap = (char*)malloc(n + 1);
-            if (heap) { memcpy(heap, t[i].request_buf, n); heap[n] = '\0'; }
-            t[i].text_ptr = heap;
-            t[i].request_set = 0;
-        }
+        slot_release(a, t[i].text_ptr);
+        t[i].text_ptr = NULL;
     }
 }
 
@@ -41,12 +253,27 @@ void ame_text_system_register(ecs_world_t* w) {
         cdp.type.alignment = (int32_t)_Alignof(Text);
         TextId = ecs_component_init(w, &cdp);
     }
+    // A prefab instance sharing or copying text_ptr would release the string twice
+    ecs_add_pair(w, TextId, EcsOnInstantiate, EcsDontInherit);
+    TextArena* a = arena_create(w);
+    if (a) a->text_id = TextId;
 
+    // Apply queued text once per frame, before the renderer reads it
+    ecs_entity_t existing = ecs_lookup(w, "SysTextApplyRequests");
+    if (existing) { ecs_delete(w, existing); }
     ecs_system_desc_t sd = {0};
-    sd.entity = ecs_entity_init(w, &(ecs_entity_desc_t){ .name = "SysTextApplyRequests", .add = (ecs_id_t[]){ EcsOnUpdate, 0 } });
+    sd.entity = ecs_entity_init(w, &(ecs_entity_desc_t){ .name = "SysTextApplyRequests", .add = (ecs_id_t[]){ ecs_pair(EcsDependsOn, EcsPreStore), 0 } });
     sd.callback = SysTextApplyRequests;
-    sd.query.terms[0].id = TextId;
     ecs_system_init(w, &sd);
+
+    existing = ecs_lookup(w, "SysTextRelease");
+    if (existing) { ecs_delete(w, existing); }
+    ecs_observer_desc_t od = {0};
+    od.entity = ecs_entity_init(w, &(ecs_entity_desc_t){ .name = "SysTextRelease" });
+    od.callback = SysTextRelease;
+    od.query.terms[0].id = TextId;
+    od.events[0] = EcsOnRemove;
+    ecs_observer_init(w, &od);
 }
 #else
 // When Flecs is disabled, provide a no-op symbol so callers can keep calling it.
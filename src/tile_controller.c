@@ -0,0 +1,194 @@
+#include "ame/tile_controller.h"
+#include <math.h>
+#include <float.h>
+
+#define TILE_GID_MASK 0x1FFFFFFFu
+
+void ame_tile_grid_from_layer(AmeTileGrid* g, const AmeTilemapLayer* layer,
+                              float tile_w, float tile_h,
+                              const uint8_t* shapes, size_t shape_count) {
+    if (!g) return;
+    g->data = layer ? layer->data : NULL;
+    g->width = layer ? layer->width : 0;
+    g->height = layer ? layer->height : 0;
+    g->tile_w = tile_w > 0.0f ? tile_w : 1.0f;
+    g->tile_h = tile_h > 0.0f ? tile_h : 1.0f;
+    g->origin_x = 0.0f;
+    g->origin_y = 0.0f;
+    g->shapes = shapes;
+    g->shape_count = shapes ? shape_count : 0;
+}
+
+AmeTileShape ame_tile_grid_shape_at(const AmeTileGrid* g, int col, int row) {
+    if (!g->data || col < 0 || row < 0 || col >= g->width || row >= g->height) return AME_TILE_EMPTY;
+    uint32_t gid = (uint32_t)g->data[row * g->width + col] & TILE_GID_MASK;
+    if (gid == 0) return AME_TILE_EMPTY;
+    if (!g->shapes) return AME_TILE_SOLID;
+    return gid < g->shape_count ? (AmeTileShape)g->shapes[gid] : AME_TILE_EMPTY;
+}
+
+static inline int is_slope(AmeTileShape s) {
+    return s == AME_TILE_SLOPE_UP_RIGHT || s == AME_TILE_SLOPE_UP_LEFT;
+}
+
+// Cell index along an axis, clamped one cell past the map so huge moves stay bounded
+static inline int cell_x(const AmeTileGrid* g, float x) {
+    float c = floorf((x - g->origin_x) / g->tile_w);
+    if (c < -1.0f) return -1;
+    if (c > (float)g->width) return g->width;
+    return (int)c;
+}
+
+static inline int cell_y(const AmeTileGrid* g, float y) {
+    float r = floorf((y - g->origin_y) / g->tile_h);
+    if (r < -1.0f) return -1;
+    if (r > (float)g->height) return g->height;
+    return (int)r;
+}
+
+static inline float col_left(const AmeTileGrid* g, int c) { return g->origin_x + (float)c * g->tile_w; }
+static inline float row_bottom(const AmeTileGrid* g, int r) { return g->origin_y + (float)r * g->tile_h; }
+
+// Floor height of a slope tile under world x
+static float slope_surface(const AmeTileGrid* g, AmeTileShape s, int c, int r, float x) {
+    float t = (x - col_left(g, c)) / g->tile_w;
+    if (t < 0.0f) t = 0.0f;
+    if (t > 1.0f) t = 1.0f;
+    if (s == AME_TILE_SLOPE_UP_LEFT) t = 1.0f - t;
+    return row_bottom(g, r) + t * g->tile_h;
+}
+
+// Horizontal pass. Solids block; slopes block only when entered from their high side.
+// lo_y: lowest world y that can still block (raised by the step/slope allowance when grounded).
+static void move_x(const AmeTileGrid* g, AmeTileMover* m, float dx, float lo_y, float skin) {
+    if (dx == 0.0f) return;
+    float top = m->y + m->half_h;
+    int r0 = cell_y(g, lo_y), r1 = cell_y(g, top - skin);
+    if (dx > 0.0f) {
+        float lead = m->x + m->half_w;
+        int c0 = cell_x(g, lead - skin) + 1, c1 = cell_x(g, lead + dx - skin);
+        for (int c = c0; c <= c1; ++c) {
+            for (int r = r0; r <= r1; ++r) {
+                AmeTileShape s = ame_tile_grid_shape_at(g, c, r);
+                if (s == AME_TILE_SOLID || s == AME_TILE_SLOPE_UP_LEFT) {
+                    m->x = col_left(g, c) - m->half_w;
+                    m->vx = 0.0f;
+                    m->flags |= AME_TILE_HIT_WALL_RIGHT;
+                    return;
+                }
+            }
+        }
+    } else {
+        float lead = m->x - m->half_w;
+        int c0 = cell_x(g, lead + skin) - 1, c1 = cell_x(g, lead + dx + skin);
+        for (int c = c0; c >= c1; --c) {
+            for (int r = r0; r <= r1; ++r) {
+                AmeTileShape s = ame_tile_grid_shape_at(g, c, r);
+                if (s == AME_TILE_SOLID || s == AME_TILE_SLOPE_UP_RIGHT) {
+                    m->x = col_left(g, c + 1) + m->half_w;
+                    m->vx = 0.0f;
+                    m->flags |= AME_TILE_HIT_WALL_LEFT;
+                    return;
+                }
+            }
+        }
+    }
+    m->x += dx;
+}
+
+void ame_tile_move(const AmeTileGrid* g, AmeTileMover* m, float dt) {
+    if (!g || !m) return;
+    const uint32_t prev = m->flags;
+    const int grounded = (prev & AME_TILE_HIT_GROUND) != 0;
+    const float skin = g->tile_h * 1e-3f;
+    const float rise = g->tile_h / g->tile_w; // slope rise per unit of x
+    m->flags = 0;
+
+    // A box resting on a slope has its lower corner below the adjacent flat tile top by up to half_w*rise
+    float step = grounded ? m->step_height : 0.0f;
+    if (grounded && (prev & AME_TILE_ON_SLOPE)) step = fmaxf(step, m->half_w * rise);
+
+    float dx = m->vx * dt;
+    move_x(g, m, dx, m->y - m->half_h + step + skin, skin);
+    float moved_x = fabsf(dx);
+
+    float dy = m->vy * dt;
+    float left = m->x - m->half_w, right = m->x + m->half_w;
+    int c0 = cell_x(g, left + skin), c1 = cell_x(g, right - skin);
+
+    if (dy > 0.0f) {
+        // Ceiling: everything except one-way platforms blocks from below
+        float top = m->y + m->half_h;
+        int r0 = cell_y(g, top - skin) + 1, r1 = cell_y(g, top + dy - skin);
+        for (int r = r0; r <= r1; ++r) {
+            for (int c = c0; c <= c1; ++c) {
+                AmeTileShape s = ame_tile_grid_shape_at(g, c, r);
+                if (s != AME_TILE_EMPTY && s != AME_TILE_ONE_WAY) {
+                    m->y = row_bottom(g, r) - m->half_h;
+                    m->vy = 0.0f;
+                    m->flags |= AME_TILE_HIT_CEILING;
+                    return;
+                }
+            }
+        }
+        m->y += dy;
+        return;
+    }
+
+    // Falling or resting: find the highest floor between the allowed step-up and the target.
+    // Grounded movers also snap down by as much as they could have descended this tick; onto a
+    // slope that includes the gap left when a box corner walks off the flat tile beside it.
+    float bottom = m->y - m->half_h;
+    float slope_tol = moved_x * rise + skin;
+    float solid_tol = step + skin;
+    float target = bottom + dy - (grounded ? moved_x * rise + skin : 0.0f);
+    float slope_target = target - (grounded ? m->half_w * rise : 0.0f);
+    int cx = cell_x(g, m->x);
+    int r_hi = cell_y(g, bottom + fmaxf(slope_tol, solid_tol)), r_lo = cell_y(g, slope_target - skin);
+    int drop = (m->options & AME_TILE_MOVER_DROP_THROUGH) != 0;
+
+    float best = -FLT_MAX;
+    AmeTileShape best_shape = AME_TILE_EMPTY;
+    for (int r = r_hi; r >= r_lo; --r) {
+        for (int c = c0; c <= c1; ++c) {
+            AmeTileShape s = ame_tile_grid_shape_at(g, c, r);
+            float surf, tol, lowest = target;
+            if (s == AME_TILE_EMPTY) continue;
+            if (s == AME_TILE_SOLID) {
+                surf = row_bottom(g, r + 1); tol = solid_tol;
+            } else if (s == AME_TILE_ONE_WAY) {
+                surf = row_bottom(g, r + 1); tol = skin;
+                if (drop) continue;
+            } else {
+                if (c != cx) continue; // slopes support the box at its bottom-center
+                surf = slope_surface(g, s, c, r, m->x); tol = slope_tol; lowest = slope_target;
+            }
+            if (surf > bottom + tol || surf < lowest) continue;
+            if (surf > best) { best = surf; best_shape = s; }
+        }
+        if (best_shape != AME_TILE_EMPTY && best >= row_bottom(g, r)) break; // lower rows cannot beat this
+    }
+
+    if (best_shape != AME_TILE_EMPTY) {
+        m->y = best + m->half_h;
+        m->vy = 0.0f;
+        m->flags |= AME_TILE_HIT_GROUND;
+        if (is_slope(best_shape)) m->flags |= AME_TILE_ON_SLOPE;
+        if (best_shape == AME_TILE_ONE_WAY) m->flags |= AME_TILE_ON_ONE_WAY;
+    } else {
+        m->y += dy;
+    }
+}
+
+void ame_tile_move_batch(const AmeTileGrid* g, AmeTileMover* movers, size_t count, float dt) {
+    if (!g || !movers) return;
+    for (size_t i = 0; i < count; ++i) ame_tile_move(g, &movers[i], dt);
+}
+
+void ame_tile_movers_write_transforms(const AmeTileMover* movers, size_t count, AmeTransform2D* out) {
+    if (!movers || !out) return;
+    for (size_t i = 0; i < count; ++i) {
+        out[i].x = movers[i].x;
+        out[i].y = movers[i].y;
+    }
+}
@@ -0,0 +1,150 @@
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ame/collider_decompose.h"
+
+// Regression test for MeshCollider2D convex decomposition: the merged polygons must cover exactly
+// the input triangles (area + point sampling), stay convex, respect the Box2D vertex limit and
+// cut the fixture count by at least 3x on typical level geometry.
+
+typedef struct { float* v; size_t tris, cap; } TriSoup;
+
+static void soup_tri(TriSoup* s, float ax, float ay, float bx, float by, float cx, float cy) {
+    if (s->tris == s->cap) {
+        s->cap = s->cap ? s->cap * 2 : 64;
+        s->v = (float*)realloc(s->v, s->cap * 6 * sizeof(float));
+        assert(s->v);
+    }
+    float* t = &s->v[s->tris * 6];
+    t[0] = ax; t[1] = ay; t[2] = bx; t[3] = by; t[4] = cx; t[5] = cy;
+    s->tris++;
+}
+
+// Quad grid as exported from an OBJ (two triangles per cell, alternating diagonal and winding)
+static void soup_grid(TriSoup* s, float x0, float y0, int cols, int rows, float cell) {
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            float ax = x0 + c * cell, ay = y0 + r * cell, bx = ax + cell, by = ay + cell;
+            if ((r + c) & 1) {
+                soup_tri(s, ax, ay, bx, ay, bx, by);
+                soup_tri(s, ax, ay, ax, by, bx, by); // clockwise on purpose
+            } else {
+                soup_tri(s, ax, ay, bx, ay, ax, by);
+                soup_tri(s, bx, ay, bx, by, ax, by);
+            }
+        }
+    }
+}
+
+// Terrain strip: polyline surface over a flat bottom, triangulated as a fan of quads
+static void soup_terrain(TriSoup* s, float x0, float bottom, int segments, float step) {
+    for (int i = 0; i < segments; ++i) {
+        float xa = x0 + i * step, xb = xa + step;
+        float ha = bottom + 2.0f + sinf((float)i * 0.35f) * 0.75f;
+        float hb = bottom + 2.0f + sinf((float)(i + 1) * 0.35f) * 0.75f;
+        soup_tri(s, xa, bottom, xb, bottom, xb, hb);
+        soup_tri(s, xa, bottom, xb, hb, xa, ha);
+    }
+}
+
+static double tri_area(const float* t) {
+    return 0.5 * fabs((double)(t[2]-t[0])*(t[5]-t[1]) - (double)(t[3]-t[1])*(t[4]-t[0]));
+}
+
+static int in_tri(const float* t, double x, double y) {
+    double d0 = (t[2]-t[0])*(y-t[1]) - (t[3]-t[1])*(x-t[0]);
+    double d1 = (t[4]-t[2])*(y-t[3]) - (t[5]-t[3])*(x-t[2]);
+    double d2 = (t[0]-t[4])*(y-t[5]) - (t[1]-t[5])*(x-t[4]);
+    return (d0 >= 0 && d1 >= 0 && d2 >= 0) || (d0 <= 0 && d1 <= 0 && d2 <= 0);
+}
+
+static int in_poly(const float* v, int n, double x, double y) {
+    for (int i = 0; i < n; ++i) {
+        const float* a = &v[i*2]; const float* b = &v[((i+1)%n)*2];
+        if ((b[0]-a[0])*(y-a[1]) - (b[1]-a[1])*(x-a[0]) < 0) return 0;
+    }
+    return 1;
+}
+
+static void check_soup(const TriSoup* s, double min_ratio, const char* label) {
+    AmeConvexDecomp d;
+    assert(ame_convex_decompose_triangles(s->v, s->tris, AME_DECOMP_MAX_POLY_VERTS, &d));
+    assert(d.poly_count > 0 && d.source_triangles == s->tris);
+
+    double area_in = 0.0, area_out = 0.0;
+    float minx = s->v[0], maxx = minx, miny = s->v[1], maxy = miny;
+    for (size_t t = 0; t < s->tris; ++t) {
+        area_in += tri_area(&s->v[t*6]);
+        for (int k = 0; k < 3; ++k) {
+            float x = s->v[t*6+k*2], y = s->v[t*6+k*2+1];
+            if (x < minx) minx = x;
+            if (x > maxx) maxx = x;
+            if (y < miny) miny = y;
+            if (y > maxy) maxy = y;
+        }
+    }
+    for (size_t p = 0; p < d.poly_count; ++p) {
+        const float* v = &d.verts[d.offsets[p]*2];
+        int n = (int)(d.offsets[p+1] - d.offsets[p]);
+        assert(n >= 3 && n <= AME_DECOMP_MAX_POLY_VERTS);
+        double a = 0.0;
+        for (int i = 0; i < n; ++i) {
+            const float* p0 = &v[i*2]; const float* p1 = &v[((i+1)%n)*2]; const float* p2 = &v[((i+2)%n)*2];
+            // strictly convex, counter-clockwise
+            assert((double)(p1[0]-p0[0])*(p2[1]-p1[1]) - (double)(p1[1]-p0[1])*(p2[0]-p1[0]) > 0.0);
+            a += (double)p0[0]*p1[1] - (double)p1[0]*p0[1];
+        }
+        area_out += 0.5 * a;
+    }
+    assert(fabs(area_in - area_out) <= 1e-4 * area_in);
+
+    // Point coverage on a jittered grid avoids sampling exactly on shared edges
+    int mismatches = 0;
+    for (int iy = 0; iy < 97; ++iy) {
+        for (int ix = 0; ix < 211; ++ix) {
+            double x = minx + (maxx - minx) * (ix + 0.37) / 211.0;
+            double y = miny + (maxy - miny) * (iy + 0.61) / 97.0;
+            int a = 0, b = 0;
+            for (size_t t = 0; t < s->tris && !a; ++t) a = in_tri(&s->v[t*6], x, y);
+            for (size_t p = 0; p < d.poly_count && !b; ++p)
+                b = in_poly(&d.verts[d.offsets[p]*2], (int)(d.offsets[p+1] - d.offsets[p]), x, y);
+            if (a != b) mismatches++;
+        }
+    }
+    assert(mismatches == 0);
+
+    double ratio = (double)s->tris / (double)d.poly_count;
+    printf("%-8s %4zu triangles -> %4zu polygons (%.1fx)\n", label, s->tris, d.poly_count, ratio);
+    assert(ratio >= min_ratio);
+    ame_convex_decomp_free(&d);
+}
+
+int main(void) {
+    TriSoup grid = {0};
+    soup_grid(&grid, 0.0f, 0.0f, 24, 4, 0.5f);
+    check_soup(&grid, 3.0, "grid");
+
+    TriSoup terrain = {0};
+    soup_terrain(&terrain, -10.0f, -3.0f, 120, 0.25f);
+    check_soup(&terrain, 3.0, "terrain");
+
+    // Mixed level: platforms plus terrain plus a degenerate sliver that must be dropped
+    TriSoup level = {0};
+    soup_grid(&level, 0.0f, 10.0f, 16, 2, 1.0f);
+    soup_grid(&level, 20.0f, 12.0f, 8, 1, 1.0f);
+    soup_terrain(&level, 0.0f, 0.0f, 64, 0.5f);
+    size_t before = level.tris;
+    soup_tri(&level, 5.0f, 20.0f, 6.0f, 20.0f, 7.0f, 20.0f);
+    AmeConvexDecomp d;
+    assert(ame_convex_decompose_triangles(level.v, level.tris, AME_DECOMP_MAX_POLY_VERTS, &d));
+    assert(d.source_triangles == before);
+    ame_convex_decomp_free(&d);
+    level.tris = before;
+    check_soup(&level, 3.0, "level");
+
+    free(grid.v); free(terrain.v); free(level.v);
+    puts("collider_decompose ok");
+    return 0;
+}
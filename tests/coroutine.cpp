@@ -0,0 +1,139 @@
+#include <cassert>
+#include <cstdio>
+
+#include "unitylike/Scene.h"
+#include "unitylike/Coroutine.h"
+
+// Coroutine scheduler: time waits longer than a wheel rotation (512 slots of 1/128 s), frame
+// waits of 64 frames and more in the frame ring, stopping a coroutine from inside itself, and
+// stale ids (older generation of a reused slot) being ignored.
+
+using namespace unitylike;
+
+struct Waiter : MongooseBehaviour {
+    int step = 0;
+    CoroutineId self;
+    CoroutineId other;
+
+    Coroutine Sleep(float seconds) { co_await WaitForSeconds(seconds); step = 1; }
+    Coroutine Frames(int frames) { co_await WaitForFrames(frames); step = 1; }
+    Coroutine StopSelf() {
+        co_await WaitForFrames(1);
+        step = 1;
+        StopCoroutine(self);
+        co_await WaitForFrames(1);
+        step = 2; // never: destroyed at the suspension above
+    }
+    Coroutine StopEverything() {
+        co_await WaitForFrames(1);
+        step = 1;
+        StopAllCoroutines();
+        co_await WaitForFrames(1);
+        step = 2;
+    }
+    Coroutine Once() { co_await WaitForFrames(1); }
+    Coroutine Count() { for (;;) { co_await WaitForFrames(1); step++; } }
+    Coroutine StopOther() { co_await WaitForFrames(1); StopCoroutine(other); }
+};
+
+// Updates at 60 Hz until the sleeper wakes; returns the seconds that went by
+static double run_until_awake(Waiter& s, int max_frames) {
+    const float dt = 1.0f / 60.0f;
+    double elapsed = 0.0;
+    for (int i = 0; i < max_frames && s.step == 0; ++i) {
+        __coroutines_update(dt);
+        elapsed += dt;
+    }
+    return elapsed;
+}
+
+// Updates until the waiter wakes; returns the number of frames
+static int frames_until_awake(Waiter& s, int max_frames) {
+    int n = 0;
+    while (n < max_frames && s.step == 0) { __coroutines_update(0.01f); ++n; }
+    return n;
+}
+
+int main(void) {
+    Waiter* s = new Waiter;
+
+    // Wheel wrap: a 10 s sleep passes its slot twice (4 s rotation) before it is due
+    s->StartCoroutine(s->Sleep(10.0f));
+    double slept = run_until_awake(*s, 60 * 20);
+    assert(s->step == 1);
+    assert(slept >= 10.0 - 1e-3 && slept < 10.0 + 1.0 / 60.0 + 1e-3);
+    assert(s->__coroutines == 0);
+
+    // Sleeps that start on every slot across a rotation boundary wake once, on time
+    for (int k = 0; k < 40; ++k) {
+        s->step = 0;
+        __coroutines_update(0.1f); // move the start point around the wheel
+        s->StartCoroutine(s->Sleep(4.5f));
+        slept = run_until_awake(*s, 60 * 10);
+        assert(s->step == 1);
+        assert(slept >= 4.5 - 1e-3 && slept < 4.5 + 1.0 / 60.0 + 1e-3);
+    }
+
+    // One long frame covers the whole wheel and still resumes the due sleeper only
+    s->step = 0;
+    s->StartCoroutine(s->Sleep(30.0f));
+    __coroutines_update(20.0f);
+    assert(s->step == 0);
+    __coroutines_update(10.0f);
+    assert(s->step == 1);
+
+    // Frame ring: 64 frames lands on the current slot, 100 frames goes round it once
+    int waits[] = { 1, 63, 64, 65, 100, 200 };
+    for (int frames : waits) {
+        s->step = 0;
+        s->StartCoroutine(s->Frames(frames));
+        int n = frames_until_awake(*s, 1000);
+        assert(s->step == 1 && n == frames);
+        (void)n;
+    }
+
+    // Stopped while running: the coroutine is released at its next suspension
+    s->step = 0;
+    s->self = s->StartCoroutine(s->StopSelf());
+    assert(s->__coroutines == 1);
+    __coroutines_update(0.01f);
+    assert(s->step == 1 && s->__coroutines == 0);
+    __coroutines_update(0.01f);
+    __coroutines_update(0.01f);
+    assert(s->step == 1);
+
+    s->step = 0;
+    s->StartCoroutine(s->StopEverything());
+    s->StartCoroutine(s->Count());
+    __coroutines_update(0.01f);
+    assert(s->__coroutines == 0);
+    int counted = s->step;
+    __coroutines_update(0.01f);
+    assert(s->step == counted && s->step < 2);
+
+    // Stale ids: the slot of a finished coroutine is reused under a new generation
+    CoroutineId old = s->StartCoroutine(s->Once());
+    __coroutines_update(0.01f);
+    assert(s->__coroutines == 0);
+    s->step = 0;
+    CoroutineId fresh = s->StartCoroutine(s->Count());
+    assert(fresh.slot == old.slot && fresh.gen != old.gen);
+    s->StopCoroutine(old);
+    assert(s->__coroutines == 1);
+    __coroutines_update(0.01f);
+    assert(s->step == 1);
+
+    // ...also when a coroutine holds the stale id of another
+    s->other = old;
+    s->StartCoroutine(s->StopOther());
+    __coroutines_update(0.01f);
+    assert(s->step == 2 && s->__coroutines == 1);
+    s->StopCoroutine(fresh);
+    assert(s->__coroutines == 0);
+    s->StopCoroutine(fresh); // twice is a no-op
+
+    __coroutines_clear();
+    delete s;
+    printf("coroutine: ok\n");
+    return 0;
+}
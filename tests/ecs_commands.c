@@ -0,0 +1,102 @@
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <flecs.h>
+
+#include "ame/ecs.h"
+#include "ame/ecs_commands.h"
+
+// Commands recorded on several threads, applied at the progress sync point: placeholders,
+// pairs, set/destroy ordering and skipping dead entities.
+
+typedef struct Position { float x, y; } Position;
+
+enum { kThreads = 4, kPerThread = 250 };
+
+static AmeEcsWorld* g_world;
+static AmeEcsId g_position, g_tag, g_root;
+
+static void* recorder_main(void* arg) {
+    int t = (int)(size_t)arg;
+    AmeEcsCommands* c = ame_ecs_commands_create(g_world);
+    for (int i = 0; i < kPerThread; ++i) {
+        AmeEcsId e = ame_ecs_cmd_create(c);
+        Position p = { (float)t, (float)i };
+        ame_ecs_cmd_set(c, e, g_position, &p, sizeof p);
+        ame_ecs_cmd_add_pair(c, e, EcsChildOf, g_root);
+        if (i % 5 == 0) ame_ecs_cmd_add(c, e, g_tag);
+        // Created and destroyed in the same batch: never visible after the flush
+        if (i % 10 == 0) {
+            AmeEcsId tmp = ame_ecs_cmd_create(c);
+            ame_ecs_cmd_set(c, tmp, g_position, &p, sizeof p);
+            ame_ecs_cmd_destroy(c, tmp);
+        }
+        if (i % 50 == 49) {
+            bool ok = ame_ecs_commands_submit(c);
+            assert(ok);
+            (void)ok;
+        }
+    }
+    return NULL;
+}
+
+int main(void) {
+    g_world = ame_ecs_world_create();
+    assert(g_world);
+    ecs_world_t* w = (ecs_world_t*)ame_ecs_world_ptr(g_world);
+    g_position = ame_ecs_component_register(g_world, "Position", sizeof(Position), _Alignof(Position));
+    g_tag = ame_ecs_entity_new(g_world);
+    g_root = ame_ecs_entity_new(g_world);
+
+    pthread_t threads[kThreads];
+    for (int t = 0; t < kThreads; ++t) pthread_create(&threads[t], NULL, recorder_main, (void*)(size_t)t);
+    for (int t = 0; t < kThreads; ++t) pthread_join(threads[t], NULL);
+
+    // Nothing applied before the sync point
+    assert(ecs_count_id(w, g_position) == 0);
+    ame_ecs_world_progress(g_world, 1.0 / 60.0);
+
+    assert(ecs_count_id(w, g_position) == kThreads * kPerThread);
+    assert(ecs_count_id(w, ecs_pair(EcsChildOf, g_root)) == kThreads * kPerThread);
+    assert(ecs_count_id(w, g_tag) == kThreads * kPerThread / 5);
+
+    // Order inside a batch is recording order: the last set wins, commands on a destroyed
+    // entity are skipped
+    AmeEcsCommands* c = ame_ecs_commands_create(g_world);
+    AmeEcsId e = ame_ecs_entity_new(g_world);
+    Position a = { 1.0f, 1.0f }, b = { 2.0f, 2.0f };
+    ame_ecs_cmd_set(c, e, g_position, &a, sizeof a);
+    ame_ecs_cmd_set(c, e, g_position, &b, sizeof b);
+    AmeEcsId gone = ame_ecs_entity_new(g_world);
+    ame_ecs_cmd_destroy(c, gone);
+    ame_ecs_cmd_set(c, gone, g_position, &a, sizeof a);
+    ame_ecs_commands_submit(c);
+    // Submitted later: applied after the first batch
+    Position last = { 3.0f, 3.0f };
+    ame_ecs_cmd_set(c, e, g_position, &last, sizeof last);
+    ame_ecs_commands_submit(c);
+    size_t applied = ame_ecs_commands_flush(g_world);
+    assert(applied == 4);
+    (void)applied;
+    Position got;
+    bool has = ame_ecs_get(g_world, e, g_position, &got, sizeof got);
+    assert(has && got.x == 3.0f);
+    (void)has;
+    assert(!ecs_is_alive(w, (ecs_entity_t)gone));
+
+    // Component ids with ECS_AUTO_OVERRIDE (the placeholder bit) are not taken for placeholders
+    AmeEcsId auto_override = (AmeEcsId)(ECS_AUTO_OVERRIDE | (ecs_id_t)g_position);
+    ame_ecs_cmd_add(c, e, auto_override);
+    ame_ecs_commands_submit(c);
+    applied = ame_ecs_commands_flush(g_world);
+    assert(applied == 1 && ecs_has_id(w, (ecs_entity_t)e, (ecs_id_t)auto_override));
+
+    // Empty submit publishes nothing
+    bool ok = ame_ecs_commands_submit(c);
+    assert(ok && ame_ecs_commands_flush(g_world) == 0);
+    (void)ok;
+
+    ame_ecs_world_destroy(g_world);
+    printf("ecs_commands: ok\n");
+    return 0;
+}
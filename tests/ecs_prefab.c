@@ -0,0 +1,90 @@
+#include <assert.h>
+#include <stdio.h>
+#include <flecs.h>
+
+#include "ame/ecs.h"
+
+// Prefab instancing: shared components are read from the prefab (one column for all
+// instances), a write adds an override to that instance only, per-instance components are
+// copied, and queries see inherited values through ecs_field_is_self.
+
+typedef struct Position { float x, y; } Position;
+typedef struct Shape { float w, h; int tex; } Shape;
+
+enum { kCount = 1000 };
+
+int main(void) {
+    AmeEcsWorld* world = ame_ecs_world_create();
+    assert(world);
+    ecs_world_t* w = (ecs_world_t*)ame_ecs_world_ptr(world);
+    AmeEcsId position = ame_ecs_component_register(world, "Position", sizeof(Position), _Alignof(Position));
+    AmeEcsId shape = ame_ecs_component_register(world, "Shape", sizeof(Shape), _Alignof(Shape));
+    ame_ecs_component_set_shared(world, shape);
+
+    AmeEcsId coin = ame_ecs_prefab_new(world, "Coin");
+    Shape s = { 8.0f, 8.0f, 3 };
+    ame_ecs_set(world, coin, shape, &s, sizeof s);
+    Position origin = { 1.0f, 2.0f };
+    ame_ecs_set(world, coin, position, &origin, sizeof origin);
+
+    Position at[kCount];
+    for (int i = 0; i < kCount; ++i) { at[i].x = (float)i; at[i].y = 0.0f; }
+    const AmeEcsId ids[] = { position };
+    const void* data[] = { at };
+    AmeEcsId ents[kCount];
+    size_t made = ame_ecs_instantiate(world, coin, kCount, ids, data, 1, ents);
+    assert(made == kCount);
+    (void)made;
+
+    // Shared: nothing stored per instance, the value comes from the prefab
+    assert(!ecs_owns_id(w, (ecs_entity_t)ents[0], (ecs_id_t)shape));
+    assert(ecs_get_id(w, (ecs_entity_t)ents[0], (ecs_id_t)shape) == ecs_get_id(w, (ecs_entity_t)coin, (ecs_id_t)shape));
+    Position p;
+    bool has = ame_ecs_get(world, ents[7], position, &p, sizeof p);
+    assert(has && p.x == 7.0f);
+    (void)has;
+
+    // Copy-on-write: the ensure adds an override holding the prefab's value
+    Shape* own = (Shape*)ecs_ensure_id(w, (ecs_entity_t)ents[1], (ecs_id_t)shape);
+    assert(own && own->tex == 3);
+    own->tex = 9;
+    ecs_modified_id(w, (ecs_entity_t)ents[1], (ecs_id_t)shape);
+    Shape got;
+    ame_ecs_get(world, ents[1], shape, &got, sizeof got);
+    assert(got.tex == 9);
+    ame_ecs_get(world, ents[2], shape, &got, sizeof got);
+    assert(got.tex == 3);
+
+    // Editing the prefab reaches every instance without an override
+    Shape bigger = { 16.0f, 16.0f, 3 };
+    ame_ecs_set(world, coin, shape, &bigger, sizeof bigger);
+    ame_ecs_get(world, ents[2], shape, &got, sizeof got);
+    assert(got.w == 16.0f);
+    ame_ecs_get(world, ents[1], shape, &got, sizeof got);
+    assert(got.w == 8.0f && got.tex == 9);
+
+    // Queries match instances; inherited fields point at the single prefab value
+    ecs_query_desc_t qd = {0};
+    qd.terms[0].id = (ecs_id_t)shape;
+    qd.terms[1].id = (ecs_id_t)position;
+    ecs_query_t* q = ecs_query_init(w, &qd);
+    int seen = 0, shared_rows = 0, own_rows = 0;
+    ecs_iter_t it = ecs_query_iter(w, q);
+    while (ecs_query_next(&it)) {
+        const Shape* col = (const Shape*)ecs_field_w_size(&it, sizeof(Shape), 0);
+        bool self = ecs_field_is_self(&it, 0);
+        for (int i = 0; i < it.count; ++i) {
+            const Shape* v = &col[self ? i : 0];
+            assert(v->w > 0.0f);
+            if (self) own_rows++; else shared_rows++;
+        }
+        seen += it.count;
+    }
+    assert(seen == kCount);       // the prefab itself is not matched
+    assert(own_rows == 1 && shared_rows == kCount - 1);
+    ecs_query_fini(q);
+
+    ame_ecs_world_destroy(world);
+    printf("ecs_prefab: ok\n");
+    return 0;
+}
@@ -0,0 +1,217 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <flecs.h>
+
+#include "ame/ecs_snapshot.h"
+
+// Round trip of the binary snapshot: plain columns from several tables, a pointer-bearing
+// component through a serializer, ChildOf hierarchy and names, a prefab with a child and its
+// instances (shared Label), and a disabled entity, loaded into a fresh world.
+
+typedef struct Position { float x, y; } Position;
+typedef struct Health { int current, max; } Health;
+typedef struct Label { const char* text; } Label;   // points into a static table
+
+ECS_COMPONENT_DECLARE(Position);
+ECS_COMPONENT_DECLARE(Health);
+ECS_COMPONENT_DECLARE(Label);
+
+static const char* k_labels[] = { "crate", "barrel", "door" };
+
+static bool save_label(const void* values, int32_t count, AmeSnapshotWriter* out, void* user) {
+    (void)user;
+    const Label* l = (const Label*)values;
+    for (int32_t i = 0; i < count; ++i) {
+        uint32_t len = (uint32_t)strlen(l[i].text);
+        if (!ame_snapshot_write(out, &len, sizeof len) || !ame_snapshot_write(out, l[i].text, len)) return false;
+    }
+    return true;
+}
+
+// Maps the stored string back onto the static table
+static bool load_label(void* values, int32_t count, const uint8_t* data, size_t size, void* user) {
+    (void)user;
+    Label* l = (Label*)values;
+    size_t pos = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        uint32_t len;
+        if (pos + sizeof len > size) return false;
+        memcpy(&len, data + pos, sizeof len);
+        pos += sizeof len;
+        if (pos + len > size) return false;
+        l[i].text = NULL;
+        for (size_t k = 0; k < sizeof k_labels / sizeof k_labels[0]; ++k) {
+            if (strlen(k_labels[k]) == len && memcmp(k_labels[k], data + pos, len) == 0) l[i].text = k_labels[k];
+        }
+        if (!l[i].text) return false;
+        pos += len;
+    }
+    return true;
+}
+
+static AmeSnapshotSchema* make_schema(ecs_world_t* w) {
+    static const AmeSnapshotSerializer label = { save_label, load_label, NULL };
+    AmeSnapshotSchema* s = ame_snapshot_schema_create();
+    bool ok = ame_snapshot_schema_add(s, w, ecs_id(Position), NULL) &&
+              ame_snapshot_schema_add(s, w, ecs_id(Health), NULL) &&
+              ame_snapshot_schema_add(s, w, ecs_id(Label), &label);
+    assert(ok);
+    (void)ok;
+    return s;
+}
+
+static void register_components(ecs_world_t* w) {
+    ECS_COMPONENT_DEFINE(w, Position);
+    ECS_COMPONENT_DEFINE(w, Health);
+    ECS_COMPONENT_DEFINE(w, Label);
+    ecs_add_pair(w, ecs_id(Label), EcsOnInstantiate, EcsInherit);
+}
+
+enum { kInstances = 10 };
+
+static int child_count(ecs_world_t* w, ecs_entity_t e) {
+    int n = 0;
+    ecs_iter_t it = ecs_children(w, e);
+    while (ecs_children_next(&it)) n += it.count;
+    return n;
+}
+
+int main(void) {
+    const char* path = "ecs_snapshot_test.bin";
+    const int count = 1000;
+
+    ecs_world_t* src = ecs_init();
+    register_components(src);
+    ecs_entity_t root = ecs_entity(src, { .name = "level" });
+    ecs_set(src, root, Position, { -1.0f, -2.0f });
+    ecs_entity_t untracked = ecs_new(src); // no schema component: not saved
+    (void)untracked;
+    for (int i = 0; i < count; ++i) {
+        ecs_entity_t e = ecs_new(src);
+        ecs_set(src, e, Position, { (float)i, (float)(2 * i) });
+        if (i % 2 == 0) ecs_set(src, e, Health, { i, 100 });
+        if (i % 3 == 0) ecs_set(src, e, Label, { k_labels[(i / 3) % 3] });
+        if (i % 10 == 0) ecs_add_pair(src, e, EcsChildOf, root);
+        if (i == 42) ecs_set_name(src, e, "answer");
+    }
+    // A prefab with a child; instances own Position and read Label from the prefab
+    ecs_entity_t crate = ecs_entity(src, { .name = "crate_prefab" });
+    ecs_add_id(src, crate, EcsPrefab);
+    ecs_set(src, crate, Position, { 0.0f, 0.0f });
+    ecs_set(src, crate, Label, { k_labels[0] });
+    ecs_entity_t lid = ecs_entity(src, { .name = "lid", .parent = crate });
+    ecs_add_id(src, lid, EcsPrefab);
+    ecs_set(src, lid, Health, { 7, 7 });
+    for (int k = 0; k < kInstances; ++k) {
+        ecs_entity_t inst = ecs_new_w_pair(src, EcsIsA, crate);
+        ecs_set(src, inst, Position, { 5000.0f + (float)k, 0.0f });
+        assert(child_count(src, inst) == 1);
+    }
+    // SetActive(false): still saved, still disabled after the load
+    ecs_entity_t hidden = ecs_entity(src, { .name = "hidden" });
+    ecs_set(src, hidden, Position, { -5.0f, -5.0f });
+    ecs_enable(src, hidden, false);
+    const int extra = 1 + 1 + 1 + kInstances * 2 + 1; // level, prefab, lid, instances + lids, hidden
+    AmeSnapshotSchema* schema = make_schema(src);
+    bool saved = ame_snapshot_save(src, schema, path);
+    assert(saved);
+    (void)saved;
+    ame_snapshot_schema_destroy(schema);
+
+    ecs_world_t* dst = ecs_init();
+    register_components(dst);
+    schema = make_schema(dst);
+    size_t loaded = 0;
+    AmeSnapshotFile* file = ame_snapshot_load(dst, schema, path, &loaded);
+    assert(file);
+    assert(loaded == (size_t)(count + extra));
+
+    ecs_entity_t level = ecs_lookup(dst, "level");
+    assert(level);
+    const Position* lp = ecs_get(dst, level, Position);
+    assert(lp && lp->x == -1.0f && lp->y == -2.0f);
+
+    ecs_entity_t answer = ecs_lookup(dst, "answer");
+    assert(answer);
+    const Position* ap = ecs_get(dst, answer, Position);
+    assert(ap && ap->x == 42.0f && ap->y == 84.0f);
+    const Health* ah = ecs_get(dst, answer, Health);
+    assert(ah && ah->current == 42 && ah->max == 100);
+    assert(ecs_get(dst, answer, Label) == NULL);
+
+    // Every saved entity comes back with the same columns
+    int positions = 0, healths = 0, labels = 0, children = 0;
+    ecs_query_t* q = ecs_query(dst, { .terms = {{ ecs_id(Position) }} });
+    ecs_iter_t it = ecs_query_iter(dst, q);
+    while (ecs_query_next(&it)) {
+        const Position* p = ecs_field(&it, Position, 0);
+        for (int i = 0; i < it.count; ++i) {
+            ecs_entity_t e = it.entities[i];
+            if (e == level || ecs_has_pair(dst, e, EcsIsA, EcsWildcard)) continue;
+            int idx = (int)p[i].x;
+            assert(p[i].y == (float)(2 * idx));
+            positions++;
+            const Health* h = ecs_get(dst, e, Health);
+            assert((h != NULL) == (idx % 2 == 0));
+            if (h) { assert(h->current == idx); healths++; }
+            const Label* l = ecs_get(dst, e, Label);
+            assert((l != NULL) == (idx % 3 == 0));
+            if (l) { assert(l->text == k_labels[(idx / 3) % 3]); labels++; }
+            bool child = ecs_has_pair(dst, e, EcsChildOf, level);
+            assert(child == (idx % 10 == 0));
+            children += child;
+        }
+    }
+    ecs_query_fini(q);
+    assert(positions == count);
+    assert(healths == count / 2);
+    assert(labels == (count + 2) / 3);
+    assert(children == count / 10);
+
+    // Prefab and instances: the shared Label is not copied, each instance has one lid
+    ecs_entity_t dcrate = ecs_lookup(dst, "crate_prefab");
+    assert(dcrate && ecs_has_id(dst, dcrate, EcsPrefab));
+    ecs_entity_t dlid = ecs_lookup(dst, "crate_prefab.lid");
+    assert(dlid && ecs_has_id(dst, dlid, EcsPrefab));
+    ecs_query_desc_t qd = {0};
+    qd.terms[0].id = ecs_pair(EcsIsA, dcrate);
+    ecs_query_t* iq = ecs_query_init(dst, &qd);
+    int instances = 0;
+    it = ecs_query_iter(dst, iq);
+    while (ecs_query_next(&it)) {
+        for (int i = 0; i < it.count; ++i) {
+            ecs_entity_t e = it.entities[i];
+            const Position* p = ecs_get(dst, e, Position);
+            assert(p && p->x >= 5000.0f && p->x < 5000.0f + kInstances);
+            assert(!ecs_owns(dst, e, Label));
+            const Label* l = ecs_get(dst, e, Label);
+            assert(l && l->text == k_labels[0]);
+            assert(child_count(dst, e) == 1);
+            instances++;
+        }
+    }
+    ecs_query_fini(iq);
+    assert(instances == kInstances);
+
+    // Disabled entities come back disabled
+    ecs_entity_t dhidden = ecs_lookup(dst, "hidden");
+    assert(dhidden && ecs_has_id(dst, dhidden, EcsDisabled));
+    const Position* hp = ecs_get(dst, dhidden, Position);
+    assert(hp && hp->x == -5.0f);
+
+    // Corrupt input is rejected without leaving entities behind
+    unsigned char junk[64] = "AMESNAP";
+    bool junk_loaded = ame_snapshot_load_memory(dst, schema, junk, sizeof junk, NULL);
+    assert(!junk_loaded);
+    (void)junk_loaded;
+
+    ame_snapshot_schema_destroy(schema);
+    ecs_fini(dst);
+    ame_snapshot_file_close(file);
+    ecs_fini(src);
+    remove(path);
+    printf("ecs_snapshot: ok (%zu entities)\n", loaded);
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ame/profiler.h"
+
+// Spans from two threads, toggling mid-span, and the Chrome trace dump.
+
+static void* worker(void* arg) {
+    (void)arg;
+    ame_profiler_set_thread_name("worker \"1\"");
+    for (int i = 0; i < 100; ++i) {
+        ame_profiler_begin("worker.job");
+        ame_profiler_end();
+    }
+    return NULL;
+}
+
+static char* read_file(const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    long n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char* buf = (char*)malloc((size_t)n + 1);
+    size_t got = fread(buf, 1, (size_t)n, f);
+    buf[got] = '\0';
+    fclose(f);
+    return buf;
+}
+
+static int count_of(const char* s, const char* needle) {
+    int n = 0;
+    for (const char* p = strstr(s, needle); p; p = strstr(p + 1, needle)) n++;
+    return n;
+}
+
+int main(void) {
+    const char* path = "profiler_test.json";
+
+    // Disabled: nothing recorded
+    ame_profiler_begin("off");
+    ame_profiler_end();
+    assert(ame_profiler_event_count() == 0);
+
+    // A span begun while off stays unrecorded even if capture starts before it ends
+    ame_profiler_begin("straddle");
+    ame_profiler_set_enabled(true);
+    ame_profiler_end();
+    assert(ame_profiler_event_count() == 0);
+
+    ame_profiler_set_thread_name("main");
+    ame_profiler_begin("frame");
+    ame_profiler_begin("frame.inner");
+    ame_profiler_end();
+    pthread_t t;
+    pthread_create(&t, NULL, worker, NULL);
+    pthread_join(t, NULL);
+    ame_profiler_end();
+    ame_profiler_set_enabled(false);
+    assert(ame_profiler_event_count() == 4 + 200);
+
+    bool written = ame_profiler_write_chrome_trace(path);
+    assert(written);
+    (void)written;
+    char* json = read_file(path);
+    assert(json);
+    assert(strstr(json, "\"traceEvents\""));
+    assert(count_of(json, "\"ph\":\"B\"") == 102);
+    assert(count_of(json, "\"ph\":\"E\"") == 102);
+    assert(count_of(json, "\"name\":\"worker.job\"") == 100);
+    assert(strstr(json, "\"name\":\"frame.inner\""));
+    assert(strstr(json, "\"worker \\\"1\\\"\""));
+    assert(!strstr(json, "straddle"));
+    free(json);
+
+    ame_profiler_clear();
+    assert(ame_profiler_event_count() == 0);
+
+    remove(path);
+    printf("profiler: ok\n");
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <flecs.h>
+
+#include "ame/text_system.h"
+
+// Text requests queue outside the Text component and land in the arena: last request wins,
+// applying in a frame, slot reuse after release, long strings, removed and dead entities.
+
+typedef struct Text {
+    const char* text_ptr;
+    unsigned int font;
+    float r, g, b, a;
+    float size;
+    int wrap_px;
+} Text;
+
+static const Text* text_of(ecs_world_t* w, ecs_entity_t text_id, ecs_entity_t e) {
+    return (const Text*)ecs_get_id(w, e, text_id);
+}
+
+int main(void) {
+    ecs_world_t* w = ecs_init();
+    ame_text_system_register(w);
+    ecs_entity_t text_id = ecs_lookup(w, "Text");
+    assert(text_id);
+
+    Text t0 = { NULL, 0, 1, 1, 1, 1, 16.0f, 0 };
+    ecs_entity_t a = ecs_new(w), b = ecs_new(w);
+    ecs_set_id(w, a, text_id, sizeof t0, &t0);
+    ecs_set_id(w, b, text_id, sizeof t0, &t0);
+
+    // Queued, not applied until the sync point; the last request per entity wins
+    assert(ame_text_request(w, a, "first", 5));
+    assert(ame_text_request(w, a, "score: 10", 9));
+    assert(ame_text_request(w, b, "", 0));
+    assert(text_of(w, text_id, a)->text_ptr == NULL);
+    assert(ame_text_apply_requests(w) == 3);
+    assert(strcmp(text_of(w, text_id, a)->text_ptr, "score: 10") == 0);
+    assert(strcmp(text_of(w, text_id, b)->text_ptr, "") == 0);
+
+    // A frame applies pending requests (SysTextApplyRequests)
+    ame_text_request(w, b, "from a frame", 12);
+    ecs_progress(w, 0);
+    assert(strcmp(text_of(w, text_id, b)->text_ptr, "from a frame") == 0);
+
+    // Same-sized replacements reuse the released slot
+    const char* before = text_of(w, text_id, a)->text_ptr;
+    ame_text_request(w, a, "score: 11", 9);
+    ame_text_apply_requests(w);
+    assert(text_of(w, text_id, a)->text_ptr == before);
+
+    // Longer than the largest slot class
+    char big[3000];
+    memset(big, 'x', sizeof big);
+    ame_text_request(w, a, big, sizeof big);
+    ame_text_apply_requests(w);
+    assert(strlen(text_of(w, text_id, a)->text_ptr) == sizeof big);
+
+    // Requests for entities that lost Text or died are dropped
+    ame_text_request(w, a, "gone", 4);
+    ame_text_request(w, b, "dead", 4);
+    ecs_remove_id(w, a, text_id);
+    ecs_delete(w, b);
+    assert(ame_text_apply_requests(w) == 0);
+
+    // Stored strings (snapshot load path) are NUL-terminated copies
+    const char* s = ame_text_store(w, "abc", 2);
+    assert(s && strcmp(s, "ab") == 0);
+    Text t1 = t0;
+    t1.text_ptr = s;
+    ecs_entity_t c = ecs_new(w);
+    ecs_set_id(w, c, text_id, sizeof t1, &t1);
+
+    ecs_fini(w);
+    printf("text_system: ok\n");
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ame/tile_controller.h"
+
+// Behaviour test for the tile-grid kinematic controller: landing, walls, ceilings,
+// one-way platforms (incl. drop-through), walking up/down a 45-degree slope and no tunneling.
+
+#define W 20
+#define H 10
+static int32_t tiles[W * H];
+static const uint8_t shapes[] = { AME_TILE_EMPTY, AME_TILE_SOLID, AME_TILE_ONE_WAY,
+                                  AME_TILE_SLOPE_UP_RIGHT, AME_TILE_SLOPE_UP_LEFT };
+
+static void set_tile(int c, int r, int gid) { tiles[r * W + c] = gid; }
+
+static int near(float a, float b) { return fabsf(a - b) < 1e-3f; }
+
+static void tick(const AmeTileGrid* g, AmeTileMover* m, float dt) {
+    m->vy -= 30.0f * dt; // gravity is the caller's business
+    ame_tile_move(g, m, dt);
+}
+
+int main(void) {
+    memset(tiles, 0, sizeof tiles);
+    for (int c = 0; c < W; ++c) set_tile(c, 0, 1);            // ground, top at y=1
+    for (int r = 1; r <= 5; ++r) { set_tile(0, r, 1); set_tile(15, r, 1); } // walls
+    for (int c = 2; c <= 5; ++c) set_tile(c, 4, 2);            // one-way, top at y=5
+    for (int c = 8; c <= 10; ++c) set_tile(c, 8, 1);           // ceiling, bottom at y=8
+    set_tile(10, 1, 3);                                        // slope up to the right
+    for (int c = 11; c <= 14; ++c) set_tile(c, 1, 1);          // raised floor, top at y=2
+
+    AmeTilemapLayer layer = { W, H, tiles };
+    AmeTileGrid g;
+    ame_tile_grid_from_layer(&g, &layer, 1.0f, 1.0f, shapes, sizeof shapes);
+    const float dt = 1.0f / 60.0f;
+
+    // Fall and land
+    AmeTileMover m = { 1.5f, 3.0f, 0.25f, 0.5f, 0.0f, 0.0f, 0.0f, 0, 0 };
+    for (int i = 0; i < 120; ++i) tick(&g, &m, dt);
+    assert(m.flags & AME_TILE_HIT_GROUND);
+    assert(near(m.y, 1.5f) && m.vy == 0.0f);
+
+    // Walk left into the wall
+    m.vx = -4.0f;
+    for (int i = 0; i < 60; ++i) { m.vx = -4.0f; tick(&g, &m, dt); }
+    assert(m.flags & AME_TILE_HIT_WALL_LEFT);
+    assert(near(m.x, 1.25f));
+
+    // Walk right up the slope onto the raised floor, staying grounded the whole way
+    m.x = 8.5f; m.y = 1.5f; m.vy = 0.0f; m.flags = AME_TILE_HIT_GROUND;
+    for (int i = 0; i < 90; ++i) {
+        m.vx = 3.0f; tick(&g, &m, dt);
+        assert(m.flags & AME_TILE_HIT_GROUND);
+        assert(!(m.flags & AME_TILE_HIT_WALL_RIGHT));
+    }
+    assert(m.x > 12.0f && near(m.y, 2.5f));
+
+    // And back down, still grounded every tick
+    for (int i = 0; i < 90; ++i) {
+        m.vx = -3.0f; tick(&g, &m, dt);
+        assert(m.flags & AME_TILE_HIT_GROUND);
+    }
+    assert(m.x < 10.0f && near(m.y, 1.5f));
+
+    // Jump up through the one-way platform, land on top, then drop through
+    m.x = 3.5f; m.y = 1.5f; m.vx = 0.0f; m.vy = 16.0f; m.flags = 0;
+    int passed_ceiling = 0;
+    for (int i = 0; i < 120; ++i) {
+        tick(&g, &m, dt);
+        if (m.flags & AME_TILE_HIT_CEILING) passed_ceiling = 1;
+    }
+    assert(!passed_ceiling);
+    assert((m.flags & AME_TILE_ON_ONE_WAY) && near(m.y, 5.5f));
+    m.options = AME_TILE_MOVER_DROP_THROUGH;
+    tick(&g, &m, dt);
+    m.options = 0;
+    for (int i = 0; i < 120; ++i) tick(&g, &m, dt);
+    assert(near(m.y, 1.5f));
+
+    // Head bump
+    AmeTileMover j = { 9.0f, 7.2f, 0.25f, 0.5f, 0.0f, 20.0f, 0.0f, 0, 0 };
+    ame_tile_move(&g, &j, dt);
+    assert((j.flags & AME_TILE_HIT_CEILING) && near(j.y, 7.5f) && j.vy == 0.0f);
+
+    // Very fast fall must not tunnel through a one-tile floor
+    AmeTileMover f = { 12.5f, 9.0f, 0.25f, 0.5f, 0.0f, -1000.0f, 0.0f, 0, 0 };
+    ame_tile_move(&g, &f, dt);
+    assert((f.flags & AME_TILE_HIT_GROUND) && near(f.y, 2.5f));
+
+    // Batch + transform writeback
+    AmeTileMover batch[64];
+    for (int i = 0; i < 64; ++i) {
+        AmeTileMover b = { 1.5f + (float)(i % 12), 8.0f, 0.25f, 0.5f, 0.0f, 0.0f, 0.0f, 0, 0 };
+        batch[i] = b;
+    }
+    for (int s = 0; s < 240; ++s) {
+        for (int i = 0; i < 64; ++i) batch[i].vy -= 30.0f * dt;
+        ame_tile_move_batch(&g, batch, 64, dt);
+    }
+    AmeTransform2D tr[64];
+    for (int i = 0; i < 64; ++i) tr[i].angle = 0.25f;
+    ame_tile_movers_write_transforms(batch, 64, tr);
+    for (int i = 0; i < 64; ++i) {
+        assert(batch[i].flags & AME_TILE_HIT_GROUND);
+        assert(tr[i].x == batch[i].x && tr[i].y == batch[i].y && tr[i].angle == 0.25f);
+    }
+
+    puts("tile_controller ok");
+    return 0;
+}